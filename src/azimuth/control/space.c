@@ -20,7 +20,9 @@
 #include "azimuth/control/space.h"
 
 #include <assert.h>
+#include <math.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include "azimuth/constants.h"
@@ -35,9 +37,14 @@
 #include "azimuth/state/player.h"
 #include "azimuth/state/save.h"
 #include "azimuth/state/space.h"
+#include "azimuth/state/uid.h"
+#include "azimuth/system/timer.h"
 #include "azimuth/tick/script.h"
 #include "azimuth/tick/space.h"
 #include "azimuth/util/misc.h"
+#include "azimuth/util/pacer.h"
+#include "azimuth/util/vector.h"
+#include "azimuth/view/gravfield.h"
 #include "azimuth/view/space.h"
 
 /*===========================================================================*/
@@ -49,6 +56,54 @@ static const char save_success_paragraph[] =
 
 static az_space_state_t state;
 
+// We tick the space state at a fixed rate (AZ_FRAME_TIME_SECONDS), but redraw
+// at whatever rate the display runs at.  To keep motion smooth when these
+// don't line up, we draw moving objects at positions interpolated between
+// where they were after each of the last couple of ticks and where they are
+// now.
+
+// If an object moves farther than this in one tick, it must have been
+// teleported (e.g. by entering a new room), so don't interpolate it:
+#define MAX_INTERPOLATION_DIST 100.0
+// If we fall this far behind, just drop the extra ticks rather than trying to
+// catch up (e.g. after returning from the pause screen):
+#define MAX_TICKS_BEHIND 4
+// Effects (particles and specks) that appeared during the last tick were
+// placed relative to some other object (e.g. exhaust behind the ship, or a
+// trail behind a projectile).  We treat the nearest interpolated object that
+// is within its bounding radius plus this distance of the effect as its
+// source, and move the effect along with it:
+#define EFFECT_SOURCE_SLOP 10.0
+
+typedef struct {
+  az_vector_t position;
+  double angle;
+} az_placement_t;
+
+static struct {
+  az_placement_t ship;
+  az_vector_t camera;
+  struct {
+    az_uid_t uid;
+    az_placement_t placement;
+  } baddies[AZ_MAX_NUM_BADDIES];
+  struct {
+    az_proj_kind_t kind;
+    double age;
+    az_placement_t placement;
+  } projectiles[AZ_ARRAY_SIZE(state.projectiles)];
+  struct {
+    az_particle_kind_t kind;
+    double age;
+    az_placement_t placement;
+  } particles[AZ_ARRAY_SIZE(state.particles)];
+  struct {
+    az_speck_kind_t kind;
+    double age;
+    az_vector_t position;
+  } specks[AZ_ARRAY_SIZE(state.specks)];
+} earlier_tick, previous_tick, current_tick;
+
 static void position_ship_at_save_point_if_any(void) {
   const az_room_t *room = &state.planet->rooms[state.ship.player.current_room];
   state.ship.position = az_bounds_center(&room->camera_bounds);
@@ -70,6 +125,11 @@ static void begin_saved_game(
   const az_saved_game_t *saved_game = &saved_games->games[saved_game_index];
 
   AZ_ZERO_OBJECT(&state);
+  // Forget the tick records from any previous game, so that nothing gets
+  // interpolated from where it was before we loaded this one.
+  AZ_ZERO_OBJECT(&earlier_tick);
+  AZ_ZERO_OBJECT(&previous_tick);
+  AZ_ZERO_OBJECT(&current_tick);
   state.planet = planet;
   state.prefs = prefs;
   state.save_file_index = saved_game_index;
@@ -117,177 +177,518 @@ static void update_held_controls(const az_key_id_t *key_for_control) {
     az_is_key_held(key_for_control[AZ_CONTROL_UTIL]);
 }
 
-az_space_action_t az_space_event_loop(
-    const az_planet_t *planet, az_saved_games_t *saved_games,
-    az_preferences_t *prefs, int saved_game_index) {
-  begin_saved_game(planet, saved_games, prefs, saved_game_index);
+/*===========================================================================*/
 
-  while (true) {
-    // If we just finished the game intro, start us on the first room.
-    if (state.intro && state.sync_vm.script == NULL) {
-      state.intro = false;
-      save_current_game(saved_games);
-      az_enter_room(&state, &planet->rooms[planet->start_room]);
-      position_ship_at_save_point_if_any();
-      az_after_entering_room(&state);
+static void record_previous_tick(void) {
+  earlier_tick = previous_tick;
+  previous_tick.ship = (az_placement_t){state.ship.position, state.ship.angle};
+  previous_tick.camera = state.camera.center;
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.baddies); ++i) {
+    const az_baddie_t *baddie = &state.baddies[i];
+    previous_tick.baddies[i].uid =
+      (baddie->kind == AZ_BAD_NOTHING ? AZ_NULL_UID : baddie->uid);
+    previous_tick.baddies[i].placement =
+      (az_placement_t){baddie->position, baddie->angle};
+  }
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.projectiles); ++i) {
+    const az_projectile_t *proj = &state.projectiles[i];
+    previous_tick.projectiles[i].kind = proj->kind;
+    previous_tick.projectiles[i].age = proj->age;
+    previous_tick.projectiles[i].placement =
+      (az_placement_t){proj->position, proj->angle};
+  }
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.particles); ++i) {
+    const az_particle_t *particle = &state.particles[i];
+    previous_tick.particles[i].kind = particle->kind;
+    previous_tick.particles[i].age = particle->age;
+    previous_tick.particles[i].placement =
+      (az_placement_t){particle->position, particle->angle};
+  }
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.specks); ++i) {
+    const az_speck_t *speck = &state.specks[i];
+    previous_tick.specks[i].kind = speck->kind;
+    previous_tick.specks[i].age = speck->age;
+    previous_tick.specks[i].position = speck->position;
+  }
+}
+
+static az_placement_t lerp_placement(az_placement_t from, az_placement_t to,
+                                     double alpha) {
+  return (az_placement_t){
+    az_vadd(from.position, az_vmul(az_vsub(to.position, from.position),
+                                   alpha)),
+    az_mod2pi(from.angle + alpha * az_mod2pi(to.angle - from.angle))
+  };
+}
+
+// Return where to draw an object that we want to show the given number of
+// ticks (between 0 and 2) behind its current placement.  The earlier
+// placement is from two ticks ago, or NULL if the object didn't exist yet.
+static az_placement_t placement_behind(
+    const az_placement_t *earlier, az_placement_t previous,
+    az_placement_t current, double behind) {
+  assert(behind >= 0.0 && behind <= 2.0);
+  if (!az_vwithin(previous.position, current.position,
+                  MAX_INTERPOLATION_DIST)) return current;
+  if (behind <= 1.0) return lerp_placement(previous, current, 1.0 - behind);
+  if (earlier == NULL || !az_vwithin(earlier->position, previous.position,
+                                     MAX_INTERPOLATION_DIST)) return previous;
+  return lerp_placement(*earlier, previous, 2.0 - behind);
+}
+
+static void interpolate(const az_placement_t *earlier, az_placement_t previous,
+                        double behind, az_vector_t *position, double *angle,
+                        az_placement_t *current_out) {
+  *current_out = (az_placement_t){*position, *angle};
+  const az_placement_t placement =
+    placement_behind(earlier, previous, *current_out, behind);
+  *position = placement.position;
+  *angle = placement.angle;
+}
+
+static az_vector_t position_behind(
+    const az_vector_t *earlier, az_vector_t previous, az_vector_t current,
+    double behind) {
+  const az_placement_t earlier_placement = {
+    (earlier != NULL ? *earlier : AZ_VZERO), 0.0
+  };
+  return placement_behind((earlier != NULL ? &earlier_placement : NULL),
+                          (az_placement_t){previous, 0.0},
+                          (az_placement_t){current, 0.0}, behind).position;
+}
+
+// Return how far an effect that appeared at the given position during the
+// last tick should be moved to stay with its source, which is the nearest
+// object that interpolate_for_drawing() moved whose bounding radius (plus
+// some slop) reaches the effect.  Must be called after the ship, baddies, and
+// projectiles have been interpolated.
+static az_vector_t effect_source_offset(az_vector_t position) {
+  double best_dist = INFINITY;
+  az_vector_t offset = AZ_VZERO;
+  const double ship_dist = az_vdist(position, current_tick.ship.position);
+  if (ship_dist <= AZ_SHIP_DEFLECTOR_RADIUS + EFFECT_SOURCE_SLOP) {
+    best_dist = ship_dist;
+    offset = az_vsub(state.ship.position, current_tick.ship.position);
+  }
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.baddies); ++i) {
+    const az_baddie_t *baddie = &state.baddies[i];
+    if (baddie->kind == AZ_BAD_NOTHING ||
+        baddie->uid != previous_tick.baddies[i].uid) continue;
+    const az_vector_t actual = current_tick.baddies[i].placement.position;
+    const double dist = az_vdist(position, actual);
+    if (dist < best_dist && dist <= baddie->data->overall_bounding_radius +
+        EFFECT_SOURCE_SLOP) {
+      best_dist = dist;
+      offset = az_vsub(baddie->position, actual);
     }
+  }
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.projectiles); ++i) {
+    const az_projectile_t *proj = &state.projectiles[i];
+    if (proj->kind == AZ_PROJ_NOTHING ||
+        proj->kind != previous_tick.projectiles[i].kind ||
+        proj->age <= previous_tick.projectiles[i].age) continue;
+    const az_vector_t actual = current_tick.projectiles[i].placement.position;
+    const double dist = az_vdist(position, actual);
+    if (dist < best_dist && dist <= EFFECT_SOURCE_SLOP) {
+      best_dist = dist;
+      offset = az_vsub(proj->position, actual);
+    }
+  }
+  return offset;
+}
 
-    // Tick the state and redraw the screen.
-    update_held_controls(prefs->key_for_control);
-    az_tick_space_state(&state, AZ_FRAME_TIME_SECONDS);
-    az_tick_audio(&state.soundboard);
-    az_start_screen_redraw(); {
-      az_space_draw_screen(&state);
-    } az_finish_screen_redraw();
-    AZ_ZERO_OBJECT(&state.ship.controls);
-
-    // Check the current mode; we may need to do something before we move on to
-    // handling events.
-    if (state.victory) {
-      az_victory_event_loop(saved_games, &state.ship.player);
-      return AZ_SA_VICTORY;
-    } else if (state.mode == AZ_MODE_GAME_OVER) {
-      // If we're at the end of the game over animation, exit this controller
-      // and signal that we should transition to the game over screen
-      // controller.
-      if (state.game_over_mode.step == AZ_GOS_FADE_OUT &&
-          state.game_over_mode.progress >= 1.0) {
-        return AZ_SA_GAME_OVER;
-      }
-    } else if (state.mode == AZ_MODE_PAUSING) {
-      // If we're at the end of the pausing fade-out, directly engage the
-      // paused screen controller, and once it's done, either resume the game
-      // or exit to the title screen, as appropriate.
-      if (state.pausing_mode.step == AZ_PSS_FADE_OUT &&
-          state.pausing_mode.fade_alpha == 1.0) {
-        switch (az_paused_event_loop(planet, prefs, &state.ship)) {
-          case AZ_PA_RESUME:
-            state.pausing_mode.step = AZ_PSS_FADE_IN;
-            break;
-          case AZ_PA_EXIT_TO_TITLE:
-            return AZ_SA_EXIT_TO_TITLE;
-        }
+// Move objects to their interpolated positions for drawing, the given number
+// of ticks (between 0 and 2) behind where they are now, saving their actual
+// positions so that restore_current_tick() can put them back.
+static void interpolate_for_drawing(double behind) {
+  interpolate(&earlier_tick.ship, previous_tick.ship, behind,
+              &state.ship.position, &state.ship.angle, &current_tick.ship);
+  current_tick.camera = state.camera.center;
+  state.camera.center = position_behind(
+      &earlier_tick.camera, previous_tick.camera, state.camera.center, behind);
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.baddies); ++i) {
+    az_baddie_t *baddie = &state.baddies[i];
+    if (baddie->kind == AZ_BAD_NOTHING ||
+        baddie->uid != previous_tick.baddies[i].uid) continue;
+    const bool was_there = (earlier_tick.baddies[i].uid == baddie->uid);
+    interpolate((was_there ? &earlier_tick.baddies[i].placement : NULL),
+                previous_tick.baddies[i].placement, behind,
+                &baddie->position, &baddie->angle,
+                &current_tick.baddies[i].placement);
+  }
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.projectiles); ++i) {
+    az_projectile_t *proj = &state.projectiles[i];
+    // A projectile in the same slot with the same kind and a greater age must
+    // be the same projectile as last tick.
+    if (proj->kind == AZ_PROJ_NOTHING ||
+        proj->kind != previous_tick.projectiles[i].kind ||
+        proj->age <= previous_tick.projectiles[i].age) continue;
+    const bool was_there =
+      (earlier_tick.projectiles[i].kind == proj->kind &&
+       earlier_tick.projectiles[i].age < previous_tick.projectiles[i].age);
+    interpolate((was_there ? &earlier_tick.projectiles[i].placement : NULL),
+                previous_tick.projectiles[i].placement, behind,
+                &proj->position, &proj->angle,
+                &current_tick.projectiles[i].placement);
+  }
+  // Effects that were already around last tick get interpolated like
+  // everything else; new ones get moved along with their source.
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.particles); ++i) {
+    az_particle_t *particle = &state.particles[i];
+    if (particle->kind == AZ_PAR_NOTHING) continue;
+    if (particle->kind == previous_tick.particles[i].kind &&
+        particle->age > previous_tick.particles[i].age) {
+      const bool was_there =
+        (earlier_tick.particles[i].kind == particle->kind &&
+         earlier_tick.particles[i].age < previous_tick.particles[i].age);
+      interpolate((was_there ? &earlier_tick.particles[i].placement : NULL),
+                  previous_tick.particles[i].placement, behind,
+                  &particle->position, &particle->angle,
+                  &current_tick.particles[i].placement);
+    } else {
+      current_tick.particles[i].placement =
+        (az_placement_t){particle->position, particle->angle};
+      az_vpluseq(&particle->position,
+                 effect_source_offset(particle->position));
+    }
+  }
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.specks); ++i) {
+    az_speck_t *speck = &state.specks[i];
+    if (speck->kind == AZ_SPECK_NOTHING) continue;
+    current_tick.specks[i].position = speck->position;
+    if (speck->kind == previous_tick.specks[i].kind &&
+        speck->age > previous_tick.specks[i].age) {
+      const bool was_there =
+        (earlier_tick.specks[i].kind == speck->kind &&
+         earlier_tick.specks[i].age < previous_tick.specks[i].age);
+      speck->position = position_behind(
+          (was_there ? &earlier_tick.specks[i].position : NULL),
+          previous_tick.specks[i].position, speck->position, behind);
+    } else {
+      az_vpluseq(&speck->position, effect_source_offset(speck->position));
+    }
+  }
+}
+
+static void restore_current_tick(void) {
+  state.ship.position = current_tick.ship.position;
+  state.ship.angle = current_tick.ship.angle;
+  state.camera.center = current_tick.camera;
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.baddies); ++i) {
+    az_baddie_t *baddie = &state.baddies[i];
+    if (baddie->kind == AZ_BAD_NOTHING ||
+        baddie->uid != previous_tick.baddies[i].uid) continue;
+    baddie->position = current_tick.baddies[i].placement.position;
+    baddie->angle = current_tick.baddies[i].placement.angle;
+  }
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.projectiles); ++i) {
+    az_projectile_t *proj = &state.projectiles[i];
+    if (proj->kind == AZ_PROJ_NOTHING ||
+        proj->kind != previous_tick.projectiles[i].kind ||
+        proj->age <= previous_tick.projectiles[i].age) continue;
+    proj->position = current_tick.projectiles[i].placement.position;
+    proj->angle = current_tick.projectiles[i].placement.angle;
+  }
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.particles); ++i) {
+    az_particle_t *particle = &state.particles[i];
+    if (particle->kind == AZ_PAR_NOTHING) continue;
+    particle->position = current_tick.particles[i].placement.position;
+    particle->angle = current_tick.particles[i].placement.angle;
+  }
+  for (int i = 0; i < AZ_ARRAY_SIZE(state.specks); ++i) {
+    az_speck_t *speck = &state.specks[i];
+    if (speck->kind == AZ_SPECK_NOTHING) continue;
+    speck->position = current_tick.specks[i].position;
+  }
+}
+
+// Draw the state to the screen, with objects interpolated so as to show the
+// state as it was the given number of ticks ago.
+static void draw_frame(double behind) {
+  interpolate_for_drawing(behind);
+  az_start_screen_redraw(); {
+    az_space_draw_screen(&state);
+  }
+  restore_current_tick();
+}
+
+/*===========================================================================*/
+
+// Set to true when a nested controller (e.g. the paused screen) has drawn to
+// the screen while we were in the middle of a frame.
+static bool screen_clobbered;
+
+// Tick the state once, and then check the current mode; we may need to do
+// something before we move on.  Returns true and sets *action_out if the
+// event loop should exit.
+static bool tick_and_check_mode(
+    const az_planet_t *planet, az_saved_games_t *saved_games,
+    az_preferences_t *prefs, az_space_action_t *action_out) {
+  // If we just finished the game intro, start us on the first room.
+  if (state.intro && state.sync_vm.script == NULL) {
+    state.intro = false;
+    save_current_game(saved_games);
+    az_enter_room(&state, &planet->rooms[planet->start_room]);
+    position_ship_at_save_point_if_any();
+    az_after_entering_room(&state);
+  }
+
+  update_held_controls(prefs->key_for_control);
+  record_previous_tick();
+  az_tick_space_state(&state, AZ_FRAME_TIME_SECONDS);
+  az_tick_audio(&state.soundboard);
+  AZ_ZERO_OBJECT(&state.ship.controls);
+
+  if (state.victory) {
+    az_victory_event_loop(saved_games, &state.ship.player);
+    *action_out = AZ_SA_VICTORY;
+    return true;
+  } else if (state.mode == AZ_MODE_GAME_OVER) {
+    // If we're at the end of the game over animation, exit this controller
+    // and signal that we should transition to the game over screen
+    // controller.
+    if (state.game_over_mode.step == AZ_GOS_FADE_OUT &&
+        state.game_over_mode.progress >= 1.0) {
+      *action_out = AZ_SA_GAME_OVER;
+      return true;
+    }
+  } else if (state.mode == AZ_MODE_PAUSING) {
+    // If we're at the end of the pausing fade-out, directly engage the
+    // paused screen controller, and once it's done, either resume the game
+    // or exit to the title screen, as appropriate.
+    if (state.pausing_mode.step == AZ_PSS_FADE_OUT &&
+        state.pausing_mode.fade_alpha == 1.0) {
+      // The paused screen draws over whatever frame we had in progress.
+      screen_clobbered = true;
+      switch (az_paused_event_loop(planet, prefs, &state.ship)) {
+        case AZ_PA_RESUME:
+          state.pausing_mode.step = AZ_PSS_FADE_IN;
+          break;
+        case AZ_PA_EXIT_TO_TITLE:
+          *action_out = AZ_SA_EXIT_TO_TITLE;
+          return true;
       }
-    } else if (state.mode == AZ_MODE_CONSOLE &&
-               state.console_mode.step == AZ_CSS_SAVE) {
-      // If we need to save the game, do so.
-      const bool ok = save_current_game(saved_games);
-      if (ok) az_set_message(&state, save_success_paragraph);
-      else az_set_message(&state, save_failed_paragraph);
     }
+  } else if (state.mode == AZ_MODE_CONSOLE &&
+             state.console_mode.step == AZ_CSS_SAVE) {
+    // If we need to save the game, do so.
+    const bool ok = save_current_game(saved_games);
+    if (ok) az_set_message(&state, save_success_paragraph);
+    else az_set_message(&state, save_failed_paragraph);
+  }
+  return false;
+}
 
-    // Handle the event queue.
-    az_event_t event;
-    while (az_poll_event(&event)) {
-      switch (event.kind) {
-        case AZ_EVENT_KEY_DOWN:
-          if (state.skip.allowed && !state.skip.active) {
-            assert(state.sync_vm.script != NULL);
-            if (prefs->key_for_control[AZ_CONTROL_PAUSE] == event.key.id) {
-              if (state.skip.cooldown < 1.0) {
-                state.skip.cooldown = 4.0;
-              } else {
-                state.skip.active = true;
-                state.skip.cooldown = 0.0;
-              }
-            } else if (event.key.id == AZ_KEY_RETURN) {
-              state.skip.cooldown = (state.skip.cooldown > 0.0 ? 4.0 : 0.3);
+// Drain the event queue, applying any keystrokes to the space state.  This
+// is called immediately before ticking, so that presses take effect in the
+// very next tick rather than waiting for a whole extra frame.
+static void handle_events(const az_preferences_t *prefs) {
+  az_event_t event;
+  while (az_poll_event(&event)) {
+    switch (event.kind) {
+      case AZ_EVENT_KEY_DOWN:
+        if (state.skip.allowed && !state.skip.active) {
+          assert(state.sync_vm.script != NULL);
+          if (prefs->key_for_control[AZ_CONTROL_PAUSE] == event.key.id) {
+            if (state.skip.cooldown < 1.0) {
+              state.skip.cooldown = 4.0;
+            } else {
+              state.skip.active = true;
+              state.skip.cooldown = 0.0;
             }
+          } else if (event.key.id == AZ_KEY_RETURN) {
+            state.skip.cooldown = (state.skip.cooldown > 0.0 ? 4.0 : 0.3);
           }
-          if (state.monologue.step != AZ_MLS_INACTIVE) {
-            if (state.monologue.step == AZ_MLS_TALK) {
-              state.monologue.step = AZ_MLS_WAIT;
-              state.monologue.progress = 0.0;
-              state.monologue.chars_to_print =
-                state.monologue.paragraph_length;
-            } else if (state.monologue.step == AZ_MLS_WAIT &&
-                       event.key.id == AZ_KEY_RETURN) {
-              assert(state.sync_vm.script != NULL);
-              az_resume_script(&state, &state.sync_vm);
-            }
+        }
+        if (state.monologue.step != AZ_MLS_INACTIVE) {
+          if (state.monologue.step == AZ_MLS_TALK) {
+            state.monologue.step = AZ_MLS_WAIT;
+            state.monologue.progress = 0.0;
+            state.monologue.chars_to_print =
+              state.monologue.paragraph_length;
+          } else if (state.monologue.step == AZ_MLS_WAIT &&
+                     event.key.id == AZ_KEY_RETURN) {
+            assert(state.sync_vm.script != NULL);
+            az_resume_script(&state, &state.sync_vm);
+          }
+          break;
+        } else if (state.dialogue.step != AZ_DLS_INACTIVE) {
+          if (state.dialogue.step == AZ_DLS_TALK) {
+            state.dialogue.step = AZ_DLS_WAIT;
+            state.dialogue.progress = 0.0;
+            state.dialogue.chars_to_print = state.dialogue.paragraph_length;
+          } else if (state.dialogue.step == AZ_DLS_WAIT &&
+                     event.key.id == AZ_KEY_RETURN) {
+            assert(state.sync_vm.script != NULL);
+            az_resume_script(&state, &state.sync_vm);
+          }
+          break;
+        } else if (state.mode == AZ_MODE_UPGRADE &&
+                   !az_is_number_key(event.key.id)) {
+          if (state.upgrade_mode.step == AZ_UGS_MESSAGE) {
+            state.upgrade_mode.step = AZ_UGS_CLOSE;
+            state.upgrade_mode.progress = 0.0;
+          }
+          break;
+        } else if (state.mode == AZ_MODE_GAME_OVER) break;
+        // Handle the keystroke:
+        const az_control_id_t control_id =
+          az_control_for_key(prefs, event.key.id);
+        switch (control_id) {
+          case AZ_CONTROL_CHARGE:
+            az_select_gun(&state.ship.player, AZ_GUN_CHARGE);
             break;
-          } else if (state.dialogue.step != AZ_DLS_INACTIVE) {
-            if (state.dialogue.step == AZ_DLS_TALK) {
-              state.dialogue.step = AZ_DLS_WAIT;
-              state.dialogue.progress = 0.0;
-              state.dialogue.chars_to_print = state.dialogue.paragraph_length;
-            } else if (state.dialogue.step == AZ_DLS_WAIT &&
-                       event.key.id == AZ_KEY_RETURN) {
-              assert(state.sync_vm.script != NULL);
-              az_resume_script(&state, &state.sync_vm);
-            }
+          case AZ_CONTROL_FREEZE:
+            az_select_gun(&state.ship.player, AZ_GUN_FREEZE);
+            break;
+          case AZ_CONTROL_TRIPLE:
+            az_select_gun(&state.ship.player, AZ_GUN_TRIPLE);
+            break;
+          case AZ_CONTROL_HOMING:
+            az_select_gun(&state.ship.player, AZ_GUN_HOMING);
+            break;
+          case AZ_CONTROL_PHASE:
+            az_select_gun(&state.ship.player, AZ_GUN_PHASE);
+            break;
+          case AZ_CONTROL_BURST:
+            az_select_gun(&state.ship.player, AZ_GUN_BURST);
+            break;
+          case AZ_CONTROL_PIERCE:
+            az_select_gun(&state.ship.player, AZ_GUN_PIERCE);
             break;
-          } else if (state.mode == AZ_MODE_UPGRADE &&
-                     !az_is_number_key(event.key.id)) {
-            if (state.upgrade_mode.step == AZ_UGS_MESSAGE) {
-              state.upgrade_mode.step = AZ_UGS_CLOSE;
-              state.upgrade_mode.progress = 0.0;
+          case AZ_CONTROL_BEAM:
+            az_select_gun(&state.ship.player, AZ_GUN_BEAM);
+            break;
+          case AZ_CONTROL_ROCKETS:
+            az_select_ordnance(&state.ship.player, AZ_ORDN_ROCKETS);
+            break;
+          case AZ_CONTROL_BOMBS:
+            az_select_ordnance(&state.ship.player, AZ_ORDN_BOMBS);
+            break;
+          case AZ_CONTROL_PAUSE:
+            if (state.mode == AZ_MODE_NORMAL &&
+                state.cutscene.scene == AZ_SCENE_NOTHING &&
+                !state.ship.autopilot.enabled) {
+              state.mode = AZ_MODE_PAUSING;
+              state.pausing_mode = (az_pausing_mode_data_t){
+                .step = AZ_PSS_FADE_OUT, .fade_alpha = 0.0
+              };
             }
             break;
-          } else if (state.mode == AZ_MODE_GAME_OVER) break;
-          // Handle the keystroke:
-          const az_control_id_t control_id =
-            az_control_for_key(prefs, event.key.id);
-          switch (control_id) {
-            case AZ_CONTROL_CHARGE:
-              az_select_gun(&state.ship.player, AZ_GUN_CHARGE);
-              break;
-            case AZ_CONTROL_FREEZE:
-              az_select_gun(&state.ship.player, AZ_GUN_FREEZE);
-              break;
-            case AZ_CONTROL_TRIPLE:
-              az_select_gun(&state.ship.player, AZ_GUN_TRIPLE);
-              break;
-            case AZ_CONTROL_HOMING:
-              az_select_gun(&state.ship.player, AZ_GUN_HOMING);
-              break;
-            case AZ_CONTROL_PHASE:
-              az_select_gun(&state.ship.player, AZ_GUN_PHASE);
-              break;
-            case AZ_CONTROL_BURST:
-              az_select_gun(&state.ship.player, AZ_GUN_BURST);
-              break;
-            case AZ_CONTROL_PIERCE:
-              az_select_gun(&state.ship.player, AZ_GUN_PIERCE);
-              break;
-            case AZ_CONTROL_BEAM:
-              az_select_gun(&state.ship.player, AZ_GUN_BEAM);
-              break;
-            case AZ_CONTROL_ROCKETS:
-              az_select_ordnance(&state.ship.player, AZ_ORDN_ROCKETS);
-              break;
-            case AZ_CONTROL_BOMBS:
-              az_select_ordnance(&state.ship.player, AZ_ORDN_BOMBS);
-              break;
-            case AZ_CONTROL_PAUSE:
-              if (state.mode == AZ_MODE_NORMAL &&
-                  state.cutscene.scene == AZ_SCENE_NOTHING &&
-                  !state.ship.autopilot.enabled) {
-                state.mode = AZ_MODE_PAUSING;
-                state.pausing_mode = (az_pausing_mode_data_t){
-                  .step = AZ_PSS_FADE_OUT, .fade_alpha = 0.0
-                };
-              }
-              break;
-            case AZ_CONTROL_UP:
-              state.ship.controls.up_pressed = true;
-              break;
-            case AZ_CONTROL_DOWN:
-              state.ship.controls.down_pressed = true;
-              break;
-            case AZ_CONTROL_FIRE:
-              state.ship.controls.fire_pressed = true;
-              break;
-            case AZ_CONTROL_UTIL:
-              state.ship.controls.util_pressed = true;
-              break;
-            default:
-              break;
-          }
-          break;
-        default: break;
+          case AZ_CONTROL_UP:
+            state.ship.controls.up_pressed = true;
+            break;
+          case AZ_CONTROL_DOWN:
+            state.ship.controls.down_pressed = true;
+            break;
+          case AZ_CONTROL_FIRE:
+            state.ship.controls.fire_pressed = true;
+            break;
+          case AZ_CONTROL_UTIL:
+            state.ship.controls.util_pressed = true;
+            break;
+          default:
+            break;
+        }
+        break;
+      default: break;
+    }
+  }
+}
+
+// In low-latency input mode, rather than sampling input right after the
+// previous buffer swap and then waiting on vsync, we sleep until just before
+// we need to start working on the next frame, so that the input we act on is
+// as fresh as possible.  To know when that is, we ask the screen pacer when
+// the last frame was presented and how fast the display refreshes, and keep
+// an estimate of how long we take to tick and draw.
+#define JIT_SAFETY_MARGIN_NANOS 2000000u
+static uint64_t jit_work_time;
+
+static void wait_for_input_deadline(const az_preferences_t *prefs) {
+  if (!prefs->low_latency_input) return;
+  // The pacer only knows the display's refresh period once vsync is pacing
+  // us; until then, there's nothing to line up with.
+  const az_pacer_t *pacer = az_get_screen_pacer();
+  if (!pacer->vsync_effective || pacer->display_period == 0) return;
+  const uint64_t lead = jit_work_time + JIT_SAFETY_MARGIN_NANOS;
+  if (lead >= pacer->display_period) return;
+  az_sleep_until(pacer->last_swap_end + pacer->display_period - lead);
+}
+
+// Return how many ticks behind the current state to draw, given how far we
+// are into the next tick, so that what's on screen always lags real time by
+// the same amount.  When pipelining, we draw before ticking, at which point
+// the state can be more than a whole tick old; drawing a fixed two ticks
+// behind real time (rather than clamping to the current state) keeps the
+// on-screen motion even when the display refresh doesn't divide the tick
+// rate.
+static double ticks_behind(uint64_t lag, bool pipelined) {
+  const double delay = (pipelined ? 2.0 : 1.0);
+  return fmax(0.0, delay - (double)lag / (double)AZ_FRAME_TIME_NANOS);
+}
+
+static void update_work_time(uint64_t work_start, uint64_t work_end) {
+  // Track the work time as a slowly-decaying peak rather than an average, so
+  // that an occasional slow frame makes us start earlier instead of missing
+  // the deadline.
+  const uint64_t work = work_end - work_start;
+  const uint64_t decayed = jit_work_time - jit_work_time / 16;
+  jit_work_time = (work > decayed ? work : decayed);
+}
+
+az_space_action_t az_space_event_loop(
+    const az_planet_t *planet, az_saved_games_t *saved_games,
+    az_preferences_t *prefs, int saved_game_index) {
+  begin_saved_game(planet, saved_games, prefs, saved_game_index);
+
+  uint64_t last_time = az_current_time_nanos();
+  uint64_t lag = AZ_FRAME_TIME_NANOS;
+  jit_work_time = 0;
+  while (true) {
+    // Sample input as late as we can, right before ticking, so that it
+    // affects the very next tick.
+    wait_for_input_deadline(prefs);
+    const uint64_t now = az_current_time_nanos();
+    handle_events(prefs);
+
+    lag += now - last_time;
+    last_time = now;
+    if (lag > MAX_TICKS_BEHIND * (uint64_t)AZ_FRAME_TIME_NANOS) {
+      lag = AZ_FRAME_TIME_NANOS;
+    }
+
+    // If pipelined drawing is on, draw the state as it is now (as of the end
+    // of the last pass's ticks), hand the frame to the GPU, and then do this
+    // pass's ticks on the CPU while the GPU draws.  The state isn't touched
+    // until the drawing commands have all been issued, so the frame is drawn
+    // from a consistent snapshot.  This costs an extra tick of latency.
+    const bool pipelined = prefs->pipelined_drawing;
+    screen_clobbered = false;
+    if (pipelined) {
+      draw_frame(ticks_behind(lag, pipelined));
+      az_submit_screen_redraw();
+    }
+
+    // Tick the state as many times as we need to in order to catch up to the
+    // current time.
+    while (lag >= AZ_FRAME_TIME_NANOS) {
+      lag -= AZ_FRAME_TIME_NANOS;
+      az_space_action_t action;
+      if (tick_and_check_mode(planet, saved_games, prefs, &action)) {
+        az_free_liquid_meshes();
+        return action;
       }
     }
+
+    // If we didn't draw the frame before ticking (or if our frame got drawn
+    // over by the paused screen), draw it now.
+    if (!pipelined || screen_clobbered) {
+      draw_frame(ticks_behind(lag, pipelined));
+    }
+    const uint64_t work_end = az_current_time_nanos();
+    az_finish_screen_redraw_at_display_rate();
+    update_work_time(now, work_end);
   }
 }
 
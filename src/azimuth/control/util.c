@@ -67,10 +67,14 @@ void az_update_preferences(const az_prefs_pane_t *pane,
   }
   if (prefs->speedrun_timer != pane->speedrun_timer_checkbox.checked ||
       prefs->fullscreen_on_startup != pane->fullscreen_checkbox.checked ||
-      prefs->enable_hints != pane->enable_hints_checkbox.checked) {
+      prefs->enable_hints != pane->enable_hints_checkbox.checked ||
+      prefs->low_latency_input != pane->low_latency_checkbox.checked ||
+      prefs->pipelined_drawing != pane->pipelined_checkbox.checked) {
     prefs->speedrun_timer = pane->speedrun_timer_checkbox.checked;
     prefs->fullscreen_on_startup = pane->fullscreen_checkbox.checked;
     prefs->enable_hints = pane->enable_hints_checkbox.checked;
+    prefs->low_latency_input = pane->low_latency_checkbox.checked;
+    prefs->pipelined_drawing = pane->pipelined_checkbox.checked;
     *prefs_changed = true;
   }
   for (int i = AZ_FIRST_CONTROL; i < AZ_NUM_CONTROLS; ++i) {
@@ -29,6 +29,7 @@
 #include "azimuth/gui/audio.h"
 #include "azimuth/system/timer.h"
 #include "azimuth/util/misc.h"
+#include "azimuth/util/pacer.h"
 #include "azimuth/util/warning.h"
 
 /*===========================================================================*/
@@ -167,13 +168,51 @@ void az_start_screen_redraw(void) {
   glLoadIdentity();
 }
 
-void az_finish_screen_redraw(void) {
+// The fastest we'll ever redraw when following the display rate, in case vsync
+// isn't working (so that we don't spin the CPU drawing thousands of frames per
+// second):
+#define MIN_DISPLAY_FRAME_TIME_NANOS 4000000u
+// Sleeping can overshoot by a millisecond or more, so to hit a deadline
+// precisely we sleep until shortly before it, and then spin for the rest:
+#define SPIN_TAIL_NANOS 1000000u
+
+static az_pacer_t pacer;
+
+static void wait_precisely_until(uint64_t deadline) {
+  if (deadline > SPIN_TAIL_NANOS) az_sleep_until(deadline - SPIN_TAIL_NANOS);
+  while (az_current_time_nanos() < deadline) {}
+}
+
+// Swap buffers, waiting first if need be so that we present frames no faster
+// than once per period.  If vsync is working, we let it do the waiting.
+static void present_frame(uint64_t period) {
   assert(sdl_initialized);
   assert(display_initialized);
+  if (pacer.period == 0) az_init_pacer(&pacer, period);
+  else az_set_pacer_period(&pacer, period);
+  const uint64_t deadline = az_pacer_next_deadline(&pacer);
+  if (deadline != 0) wait_precisely_until(deadline);
+  const uint64_t swap_start = az_current_time_nanos();
   SDL_GL_SwapBuffers();
-  // Synchronize, in case vsync fails to lock us to 60Hz:
-  static uint64_t sync_time = 0;
-  sync_time = az_sleep_until(sync_time) + AZ_FRAME_TIME_NANOS;
+  az_pacer_frame_presented(&pacer, swap_start, az_current_time_nanos());
+}
+
+void az_finish_screen_redraw(void) {
+  present_frame(AZ_FRAME_TIME_NANOS);
+}
+
+void az_finish_screen_redraw_at_display_rate(void) {
+  present_frame(MIN_DISPLAY_FRAME_TIME_NANOS);
+}
+
+void az_submit_screen_redraw(void) {
+  assert(sdl_initialized);
+  assert(display_initialized);
+  glFlush();
+}
+
+const az_pacer_t *az_get_screen_pacer(void) {
+  return &pacer;
 }
 
 /*===========================================================================*/
@@ -23,6 +23,8 @@
 
 #include <stdbool.h>
 
+#include "azimuth/util/pacer.h"
+
 /*===========================================================================*/
 
 typedef void (*az_init_func_t)(void);
@@ -47,6 +49,20 @@ void az_set_fullscreen(bool fullscreen);
 // with OpenGL.
 void az_start_screen_redraw(void);
 void az_finish_screen_redraw(void);
+// Use this instead of az_finish_screen_redraw to let the frame rate follow the
+// display's refresh rate (via vsync) rather than locking it to 60Hz.  This is
+// for controllers that tick their state at a fixed rate independently of how
+// often they redraw.
+void az_finish_screen_redraw_at_display_rate(void);
+// Call this after issuing all the drawing commands for a frame, but before
+// finishing the redraw, to have OpenGL start executing them right away.  The
+// caller can then get other work done on the CPU (such as ticking the state
+// for the next frame) while the GPU draws this one.
+void az_submit_screen_redraw(void);
+
+// Get the pacer that decides when finished frames are presented, e.g. to
+// inspect its frame-time histogram or to see whether vsync is working.
+const az_pacer_t *az_get_screen_pacer(void);
 
 /*===========================================================================*/
 
@@ -37,7 +37,12 @@
 #include "azimuth/system/resource.h"
 #include "azimuth/util/misc.h" // for AZ_ASSERT_UNREACHABLE
 #include "azimuth/util/prefs.h"
+#include "azimuth/view/background.h" // for az_init_background_drawing
+#include "azimuth/view/baddie.h" // for az_init_baddie_drawing
 #include "azimuth/view/dialog.h" // for az_init_portrait_drawing
+#include "azimuth/view/doodad.h" // for az_init_doodad_drawing
+#include "azimuth/view/paused.h" // for az_init_paused_drawing
+#include "azimuth/view/string.h" // for az_init_string_drawing
 #include "azimuth/view/wall.h" // for az_init_wall_drawing
 
 /*===========================================================================*/
@@ -62,8 +67,13 @@ int main(int argc, char **argv) {
   az_init_sound_datas();
   az_init_baddie_datas();
   az_init_wall_datas();
+  az_register_gl_init_func(az_init_string_drawing);
+  az_register_gl_init_func(az_init_background_drawing);
+  az_register_gl_init_func(az_init_baddie_drawing);
   az_register_gl_init_func(az_init_portrait_drawing);
   az_register_gl_init_func(az_init_wall_drawing);
+  az_register_gl_init_func(az_init_doodad_drawing);
+  az_register_gl_init_func(az_init_paused_drawing);
 
   if (!load_scenario()) {
     printf("Failed to load scenario.\n");
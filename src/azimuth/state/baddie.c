@@ -2044,6 +2044,7 @@ static void init_component_data(az_component_data_t *component) {
     assert(component->bounding_radius == 0.0);
     component->bounding_radius =
       polygon_bounding_radius(component->polygon);
+    az_init_polygon_pieces(&component->polygon);
   } else assert(component->bounding_radius > 0.0);
 }
 
@@ -43,8 +43,10 @@
 #define AZ_MAX_NUM_NODES 150
 #define AZ_MAX_NUM_WALLS 300
 
-// The size of the UUID table:
-#define AZ_NUM_UUID_SLOTS 50
+// The size of the UUID table.  Looking up an object from its UUID slot costs
+// the same no matter how large this is; it's kept to two digits so that the
+// editor can label slots compactly.
+#define AZ_NUM_UUID_SLOTS 99
 
 typedef struct {
   az_baddie_kind_t kind;
@@ -188,9 +188,13 @@ typedef struct {
   double stack[20];
 } az_script_vm_t;
 
+// The maximum number of script timers that can be pending at once.
+#define AZ_MAX_NUM_TIMERS 100
+
 typedef struct {
-  double time_remaining;
-  az_script_vm_t vm; // if script is NULL, this timer is not present
+  double due_time; // goes off once the space state's timer_time reaches this
+  unsigned int serial; // breaks ties in due_time, in order of scheduling
+  az_script_vm_t vm;
 } az_timer_t;
 
 // Serialize the script and return true, or return false on error.
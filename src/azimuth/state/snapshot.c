@@ -0,0 +1,200 @@
+/*=============================================================================
+| Copyright 2012 Matthew D. Steele <mdsteele@alum.mit.edu>                    |
+|                                                                             |
+| This file is part of Azimuth.                                               |
+|                                                                             |
+| Azimuth is free software: you can redistribute it and/or modify it under    |
+| the terms of the GNU General Public License as published by the Free        |
+| Software Foundation, either version 3 of the License, or (at your option)   |
+| any later version.                                                          |
+|                                                                             |
+| Azimuth is distributed in the hope that it will be useful, but WITHOUT      |
+| ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or       |
+| FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for   |
+| more details.                                                               |
+|                                                                             |
+| You should have received a copy of the GNU General Public License along     |
+| with Azimuth.  If not, see <http://www.gnu.org/licenses/>.                  |
+=============================================================================*/
+
+
+#include "azimuth/state/snapshot.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "azimuth/state/space.h"
+#include "azimuth/util/misc.h"
+#include "azimuth/util/random.h"
+
+/*===========================================================================*/
+
+void az_take_space_snapshot(const az_space_state_t *state,
+                            az_space_snapshot_t *snapshot_out) {
+  snapshot_out->state = *state;
+  snapshot_out->seed = az_get_global_random_seed();
+}
+
+void az_restore_space_snapshot(const az_space_snapshot_t *snapshot,
+                               az_space_state_t *state_out) {
+  *state_out = snapshot->state;
+  az_set_global_random_seed(snapshot->seed);
+}
+
+/*===========================================================================*/
+
+// Deltas compare snapshots in blocks of this many bytes.  A delta consists of
+// a sequence of runs, each of which is a header (a byte offset and a length,
+// both uint32_t) followed by that many bytes of replacement data.
+#define DELTA_BLOCK_SIZE 64
+#define DELTA_HEADER_SIZE (2 * sizeof(uint32_t))
+
+AZ_STATIC_ASSERT(sizeof(az_space_snapshot_t) <= UINT32_MAX);
+
+static bool block_differs(const uint8_t *from, const uint8_t *to,
+                          size_t offset) {
+  const size_t length =
+    (sizeof(az_space_snapshot_t) - offset < DELTA_BLOCK_SIZE ?
+     sizeof(az_space_snapshot_t) - offset : DELTA_BLOCK_SIZE);
+  return 0 != memcmp(from + offset, to + offset, length);
+}
+
+// Calls fn(offset, length, param) for each maximal run of blocks that differ
+// between the two snapshots.
+static void for_each_run(
+    const az_space_snapshot_t *from, const az_space_snapshot_t *to,
+    void (*fn)(size_t, size_t, void*), void *param) {
+  const uint8_t *from_bytes = (const uint8_t *)from;
+  const uint8_t *to_bytes = (const uint8_t *)to;
+  const size_t total = sizeof(az_space_snapshot_t);
+  size_t offset = 0;
+  while (offset < total) {
+    if (!block_differs(from_bytes, to_bytes, offset)) {
+      offset += DELTA_BLOCK_SIZE;
+      continue;
+    }
+    const size_t start = offset;
+    do {
+      offset += DELTA_BLOCK_SIZE;
+    } while (offset < total && block_differs(from_bytes, to_bytes, offset));
+    if (offset > total) offset = total;
+    fn(start, offset - start, param);
+  }
+}
+
+static void count_run(size_t offset, size_t length, void *param) {
+  *(size_t *)param += DELTA_HEADER_SIZE + length;
+}
+
+typedef struct {
+  const uint8_t *source;
+  uint8_t *dest;
+} write_run_param_t;
+
+static void write_run(size_t offset, size_t length, void *param) {
+  write_run_param_t *wrp = param;
+  const uint32_t header[2] = {offset, length};
+  memcpy(wrp->dest, header, DELTA_HEADER_SIZE);
+  memcpy(wrp->dest + DELTA_HEADER_SIZE, wrp->source + offset, length);
+  wrp->dest += DELTA_HEADER_SIZE + length;
+}
+
+// Compute a delta that will turn `from` into `to`, storing it in a newly
+// allocated buffer.  Returns the size of the delta (the buffer will be NULL if
+// the size is zero).
+static size_t make_delta(const az_space_snapshot_t *from,
+                         const az_space_snapshot_t *to, uint8_t **data_out) {
+  size_t size = 0;
+  for_each_run(from, to, count_run, &size);
+  *data_out = AZ_ALLOC(size, uint8_t);
+  write_run_param_t param = {.source = (const uint8_t *)to, .dest = *data_out};
+  for_each_run(from, to, write_run, &param);
+  assert(param.dest == *data_out + size);
+  return size;
+}
+
+static void apply_delta(const uint8_t *data, size_t size,
+                        az_space_snapshot_t *snapshot) {
+  uint8_t *bytes = (uint8_t *)snapshot;
+  const uint8_t *end = data + size;
+  while (data < end) {
+    uint32_t header[2];
+    memcpy(header, data, DELTA_HEADER_SIZE);
+    data += DELTA_HEADER_SIZE;
+    assert(header[0] + header[1] <= sizeof(az_space_snapshot_t));
+    memcpy(bytes + header[0], data, header[1]);
+    data += header[1];
+  }
+  assert(data == end);
+}
+
+/*===========================================================================*/
+
+void az_init_snapshot_ring(az_snapshot_ring_t *ring) {
+  AZ_ZERO_OBJECT(ring);
+  ring->newest = AZ_ALLOC(1, az_space_snapshot_t);
+  ring->scratch = AZ_ALLOC(1, az_space_snapshot_t);
+}
+
+void az_destroy_snapshot_ring(az_snapshot_ring_t *ring) {
+  free(ring->newest);
+  free(ring->scratch);
+  AZ_ARRAY_LOOP(delta, ring->deltas) free(delta->data);
+  AZ_ZERO_OBJECT(ring);
+}
+
+// Free the given delta, and shift all older deltas down to fill the gap.
+static void remove_delta(az_snapshot_ring_t *ring, int index) {
+  const int num_deltas = AZ_ARRAY_SIZE(ring->deltas);
+  assert(index >= 0 && index < num_deltas);
+  free(ring->deltas[index].data);
+  memmove(&ring->deltas[index], &ring->deltas[index + 1],
+          (num_deltas - index - 1) * sizeof(ring->deltas[0]));
+  ring->deltas[num_deltas - 1].size = 0;
+  ring->deltas[num_deltas - 1].data = NULL;
+}
+
+void az_push_snapshot(az_snapshot_ring_t *ring,
+                      const az_space_state_t *state) {
+  assert(ring->newest != NULL);
+  assert(ring->num_snapshots >= 0);
+  assert(ring->num_snapshots <= AZ_SNAPSHOT_RING_SIZE);
+  az_space_snapshot_t *snapshot = ring->scratch;
+  az_take_space_snapshot(state, snapshot);
+  if (ring->num_snapshots > 0) {
+    // Make room for a new delta at the front, discarding the oldest delta if
+    // the ring is full.
+    const int num_deltas = AZ_ARRAY_SIZE(ring->deltas);
+    if (ring->num_snapshots == AZ_SNAPSHOT_RING_SIZE) {
+      remove_delta(ring, num_deltas - 1);
+      --ring->num_snapshots;
+    }
+    assert(ring->deltas[num_deltas - 1].data == NULL);
+    memmove(&ring->deltas[1], &ring->deltas[0],
+            (num_deltas - 1) * sizeof(ring->deltas[0]));
+    ring->deltas[0].size =
+      make_delta(snapshot, ring->newest, &ring->deltas[0].data);
+  }
+  ring->scratch = ring->newest;
+  ring->newest = snapshot;
+  ++ring->num_snapshots;
+}
+
+bool az_rewind_snapshot_ring(az_snapshot_ring_t *ring, int age,
+                             az_space_state_t *state_out) {
+  assert(age >= 0);
+  if (age >= ring->num_snapshots) return false;
+  for (int i = 0; i < age; ++i) {
+    apply_delta(ring->deltas[0].data, ring->deltas[0].size, ring->newest);
+    remove_delta(ring, 0);
+    --ring->num_snapshots;
+  }
+  az_restore_space_snapshot(ring->newest, state_out);
+  return true;
+}
+
+/*===========================================================================*/
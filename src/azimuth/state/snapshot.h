@@ -0,0 +1,101 @@
+/*=============================================================================
+| Copyright 2012 Matthew D. Steele <mdsteele@alum.mit.edu>                    |
+|                                                                             |
+| This file is part of Azimuth.                                               |
+|                                                                             |
+| Azimuth is free software: you can redistribute it and/or modify it under    |
+| the terms of the GNU General Public License as published by the Free        |
+| Software Foundation, either version 3 of the License, or (at your option)   |
+| any later version.                                                          |
+|                                                                             |
+| Azimuth is distributed in the hope that it will be useful, but WITHOUT      |
+| ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or       |
+| FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for   |
+| more details.                                                               |
+|                                                                             |
+| You should have received a copy of the GNU General Public License along     |
+| with Azimuth.  If not, see <http://www.gnu.org/licenses/>.                  |
+=============================================================================*/
+
+
+#pragma once
+#ifndef AZIMUTH_STATE_SNAPSHOT_H_
+#define AZIMUTH_STATE_SNAPSHOT_H_
+
+#include <stdbool.h>
+#include <stddef.h> // for size_t
+#include <stdint.h>
+
+#include "azimuth/state/space.h"
+#include "azimuth/util/random.h"
+
+/*===========================================================================*/
+
+// A complete copy of the simulation state at one moment: the space state plus
+// the global random seed (so that a restored simulation will play out the same
+// way as the original did).
+//
+// The pointers within az_space_state_t all point either into the planet or
+// into static data tables (baddie/wall/projectile data, scripts, paragraphs),
+// none of which change during play, so a snapshot can simply store them as-is.
+// This means that a snapshot is only valid within the process that took it;
+// it is not meant to be written to disk (that's what save files are for).
+typedef struct {
+  az_space_state_t state;
+  az_random_seed_t seed;
+} az_space_snapshot_t;
+
+// Record the current simulation state into the snapshot.
+void az_take_space_snapshot(const az_space_state_t *state,
+                            az_space_snapshot_t *snapshot_out);
+
+// Restore the simulation state from the snapshot.
+void az_restore_space_snapshot(const az_space_snapshot_t *snapshot,
+                               az_space_state_t *state_out);
+
+/*===========================================================================*/
+
+// The maximum number of snapshots that a snapshot ring will hold.
+#define AZ_SNAPSHOT_RING_SIZE 10
+
+// A ring of recent snapshots (e.g. one per second of play), for rewinding.
+// Only the newest snapshot is stored in full; each older snapshot is stored as
+// a delta against the next-newer one, containing just the parts of the state
+// that differ.  Since most of the space state (walls, doors, nodes, empty
+// object slots) doesn't change from one second to the next, these deltas are
+// typically much smaller than a full snapshot.
+typedef struct {
+  int num_snapshots;
+  az_space_snapshot_t *newest;
+  az_space_snapshot_t *scratch;
+  // deltas[i] turns the (i)th-newest snapshot into the (i+1)th-newest:
+  struct {
+    size_t size;
+    uint8_t *data;
+  } deltas[AZ_SNAPSHOT_RING_SIZE - 1];
+} az_snapshot_ring_t;
+
+// Initialize an empty ring.  The ring must later be destroyed with
+// az_destroy_snapshot_ring.
+void az_init_snapshot_ring(az_snapshot_ring_t *ring);
+
+// Free all memory held by the ring and reset it to empty.
+void az_destroy_snapshot_ring(az_snapshot_ring_t *ring);
+
+// Take a snapshot of the current simulation state and add it to the ring as
+// the newest snapshot.  If the ring is already full, the oldest snapshot is
+// discarded.
+void az_push_snapshot(az_snapshot_ring_t *ring,
+                      const az_space_state_t *state);
+
+// Restore the simulation state from the (age)th-newest snapshot in the ring
+// (where age 0 is the newest) and return true, or return false if the ring
+// has fewer than age+1 snapshots.  Afterwards, the restored snapshot and any
+// snapshots older than it remain in the ring; newer ones are discarded, so
+// that subsequent pushes continue from the restored point.
+bool az_rewind_snapshot_ring(az_snapshot_ring_t *ring, int age,
+                             az_space_state_t *state_out);
+
+/*===========================================================================*/
+
+#endif // AZIMUTH_STATE_SNAPSHOT_H_
@@ -22,11 +22,13 @@
 #include <assert.h>
 #include <math.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "azimuth/state/room.h"
 #include "azimuth/state/uid.h"
 #include "azimuth/state/upgrade.h"
 #include "azimuth/util/misc.h"
+#include "azimuth/util/polygon.h"
 #include "azimuth/util/vector.h"
 #include "azimuth/util/warning.h"
 
@@ -43,9 +45,13 @@ void az_clear_space(az_space_state_t *state) {
   AZ_ZERO_ARRAY(state->pickups);
   AZ_ZERO_ARRAY(state->projectiles);
   AZ_ZERO_ARRAY(state->specks);
-  AZ_ZERO_ARRAY(state->timers);
+  state->num_timers = 0;
+  state->timer_time = 0.0;
+  state->next_timer_serial = 0;
   AZ_ZERO_ARRAY(state->walls);
   AZ_ZERO_ARRAY(state->uuids);
+  state->first_free_particle = state->first_free_speck = 0;
+  AZ_ZERO_OBJECT(&state->homing_targets);
 }
 
 static void put_uuid(az_space_state_t *state, int slot,
@@ -60,25 +66,21 @@ static void put_uuid(az_space_state_t *state, int slot,
 
 void az_enter_room(az_space_state_t *state, const az_room_t *room) {
   state->darkness = state->dark_goal = 0.0;
-  // Make a map from UUID table indices to the baddie (if any) carrying that
-  // object as cargo.
-  az_baddie_t *cargo_carriers[AZ_NUM_UUID_SLOTS];
-  AZ_ZERO_ARRAY(cargo_carriers);
+  // Remember which baddie was created for each baddie spec, so that we can
+  // fill in cargo tables once the UUID table is populated.  This is sized by
+  // the number of baddies in the room rather than by the UUID table, so that
+  // the UUID table can be made larger without making this any slower.
+  assert(room->num_baddies <= AZ_MAX_NUM_BADDIES);
+  az_baddie_t *spec_baddies[AZ_MAX_NUM_BADDIES];
   // Insert objects into space:
   for (int i = 0; i < room->num_baddies; ++i) {
     const az_baddie_spec_t *spec = &room->baddies[i];
     az_baddie_t *baddie =
       az_add_baddie(state, spec->kind, spec->position, spec->angle);
+    spec_baddies[i] = baddie;
     if (baddie != NULL) {
       baddie->on_kill = spec->on_kill;
       put_uuid(state, spec->uuid_slot, AZ_UUID_BADDIE, baddie->uid);
-      AZ_ARRAY_LOOP(slot, spec->cargo_slots) {
-        if (*slot == 0) continue;
-        const int slot_index = *slot - 1;
-        assert(slot_index >= 0);
-        assert(slot_index < AZ_ARRAY_SIZE(cargo_carriers));
-        cargo_carriers[slot_index] = baddie;
-      }
     }
   }
   for (int i = 0; i < room->num_doors; ++i) {
@@ -163,15 +165,18 @@ void az_enter_room(az_space_state_t *state, const az_room_t *room) {
   }
   // Now that all objects are inserted and the UUID table is populated, fill in
   // each baddie's cargo table:
-  for (int i = 0; i < AZ_ARRAY_SIZE(cargo_carriers); ++i) {
-    az_baddie_t *baddie = cargo_carriers[i];
+  for (int i = 0; i < room->num_baddies; ++i) {
+    az_baddie_t *baddie = spec_baddies[i];
     if (baddie == NULL) continue;
     assert(baddie->kind != AZ_BAD_NOTHING);
-    AZ_ARRAY_LOOP(cargo, baddie->cargo_uuids) {
-      if (cargo->type == AZ_UUID_NOTHING) {
-        *cargo = state->uuids[i];
-        break;
-      }
+    const az_baddie_spec_t *spec = &room->baddies[i];
+    AZ_STATIC_ASSERT(AZ_ARRAY_SIZE(spec->cargo_slots) ==
+                     AZ_ARRAY_SIZE(baddie->cargo_uuids));
+    int num_cargo = 0;
+    AZ_ARRAY_LOOP(slot, spec->cargo_slots) {
+      if (*slot == 0) continue;
+      assert(*slot > 0 && *slot <= AZ_ARRAY_SIZE(state->uuids));
+      baddie->cargo_uuids[num_cargo++] = state->uuids[*slot - 1];
     }
   }
 }
@@ -187,12 +192,43 @@ void az_set_message(az_space_state_t *state, const char *paragraph) {
   };
 }
 
+static void add_homing_target(az_target_list_t *list,
+                              const az_baddie_t *baddie) {
+  assert(list->num_targets < AZ_ARRAY_SIZE(list->uids));
+  list->uids[list->num_targets] = baddie->uid;
+  list->positions[list->num_targets] = baddie->position;
+  ++list->num_targets;
+}
+
+static void add_homing_targets(az_space_state_t *state,
+                               const az_baddie_t *baddie) {
+  // The lists may be full of baddies that have since been killed; if so,
+  // rebuild them from scratch instead (which will pick up this baddie too).
+  if (state->homing_targets.proj.num_targets >= AZ_MAX_NUM_BADDIES ||
+      state->homing_targets.beam.num_targets >= AZ_MAX_NUM_BADDIES ||
+      state->homing_targets.phase.num_targets >= AZ_MAX_NUM_BADDIES) {
+    az_update_homing_targets(state);
+    return;
+  }
+  if (az_baddie_has_flag(baddie, AZ_BADF_INCORPOREAL)) return;
+  if (!az_baddie_has_flag(baddie, AZ_BADF_NO_HOMING_PROJ)) {
+    add_homing_target(&state->homing_targets.proj, baddie);
+  }
+  if (!az_baddie_has_flag(baddie, AZ_BADF_NO_HOMING_BEAM)) {
+    add_homing_target(&state->homing_targets.beam, baddie);
+  }
+  if (!az_baddie_has_flag(baddie, AZ_BADF_NO_HOMING_PHASE)) {
+    add_homing_target(&state->homing_targets.phase, baddie);
+  }
+}
+
 az_baddie_t *az_add_baddie(az_space_state_t *state, az_baddie_kind_t kind,
                            az_vector_t position, double angle) {
   AZ_ARRAY_LOOP(baddie, state->baddies) {
     if (baddie->kind == AZ_BAD_NOTHING) {
       az_assign_uid(baddie - state->baddies, &baddie->uid);
       az_init_baddie(baddie, kind, position, angle);
+      add_homing_targets(state, baddie);
       return baddie;
     }
   }
@@ -203,13 +239,17 @@ az_baddie_t *az_add_baddie(az_space_state_t *state, az_baddie_kind_t kind,
 
 bool az_insert_particle(az_space_state_t *state,
                         az_particle_t **particle_out) {
-  AZ_ARRAY_LOOP(particle, state->particles) {
+  const int num_particles = AZ_ARRAY_SIZE(state->particles);
+  for (int i = state->first_free_particle; i < num_particles; ++i) {
+    az_particle_t *particle = &state->particles[i];
     if (particle->kind == AZ_PAR_NOTHING) {
       particle->age = 0.0;
+      state->first_free_particle = i + 1;
       *particle_out = particle;
       return true;
     }
   }
+  state->first_free_particle = num_particles;
   AZ_WARNING_ONCE("Failed to insert particle; array is full.\n");
   return false;
 }
@@ -232,8 +272,11 @@ void az_add_beam(az_space_state_t *state, az_color_t color, az_vector_t start,
 
 void az_add_speck(az_space_state_t *state, az_color_t color, double lifetime,
                   az_vector_t position, az_vector_t velocity) {
-  AZ_ARRAY_LOOP(speck, state->specks) {
+  const int num_specks = AZ_ARRAY_SIZE(state->specks);
+  for (int i = state->first_free_speck; i < num_specks; ++i) {
+    az_speck_t *speck = &state->specks[i];
     if (speck->kind == AZ_SPECK_NOTHING) {
+      state->first_free_speck = i + 1;
       speck->kind = AZ_SPECK_NORMAL;
       speck->color = color;
       speck->position = position;
@@ -243,6 +286,7 @@ void az_add_speck(az_space_state_t *state, az_color_t color, double lifetime,
       return;
     }
   }
+  state->first_free_speck = num_specks;
   AZ_WARNING_ONCE("Failed to add speck; array is full.\n");
 }
 
@@ -312,80 +356,94 @@ az_pickup_t *az_add_random_pickup(az_space_state_t *state,
 
 /*===========================================================================*/
 
-const az_camera_bounds_t *az_current_camera_bounds(
-    const az_space_state_t *state) {
-  return &state->planet->rooms[state->ship.player.current_room].camera_bounds;
+void az_update_homing_targets(az_space_state_t *state) {
+  state->homing_targets.proj.num_targets = 0;
+  state->homing_targets.beam.num_targets = 0;
+  state->homing_targets.phase.num_targets = 0;
+  AZ_ARRAY_LOOP(baddie, state->baddies) {
+    if (baddie->kind == AZ_BAD_NOTHING) continue;
+    add_homing_targets(state, baddie);
+  }
 }
 
-bool az_lookup_baddie(az_space_state_t *state, az_uid_t uid,
-                      az_baddie_t **baddie_out) {
-  const int index = az_uid_index(uid);
-  assert(0 <= index && index < AZ_ARRAY_SIZE(state->baddies));
-  az_baddie_t *baddie = &state->baddies[index];
-  if (baddie->kind != AZ_BAD_NOTHING && baddie->uid == uid) {
-    *baddie_out = baddie;
-    return true;
-  }
+bool az_resolve_homing_target(az_space_state_t *state, az_target_list_t *list,
+                              int index, az_baddie_t **baddie_out) {
+  assert(0 <= index && index < list->num_targets);
+  if (az_lookup_baddie(state, list->uids[index], baddie_out)) return true;
+  const int num_after = --list->num_targets - index;
+  memmove(&list->uids[index], &list->uids[index + 1],
+          num_after * sizeof(az_uid_t));
+  memmove(&list->positions[index], &list->positions[index + 1],
+          num_after * sizeof(az_vector_t));
   return false;
 }
 
-bool az_lookup_door(az_space_state_t *state, az_uid_t uid,
-                    az_door_t **door_out) {
-  const int index = az_uid_index(uid);
-  assert(0 <= index && index < AZ_ARRAY_SIZE(state->doors));
-  az_door_t *door = &state->doors[index];
-  if (door->kind != AZ_DOOR_NOTHING && door->uid == uid) {
-    *door_out = door;
-    return true;
-  }
-  return false;
+const az_camera_bounds_t *az_current_camera_bounds(
+    const az_space_state_t *state) {
+  return &state->planet->rooms[state->ship.player.current_room].camera_bounds;
 }
 
-bool az_lookup_gravfield(az_space_state_t *state, az_uid_t uid,
-                         az_gravfield_t **gravfield_out) {
-  const int index = az_uid_index(uid);
-  assert(0 <= index && index < AZ_ARRAY_SIZE(state->gravfields));
-  az_gravfield_t *gravfield = &state->gravfields[index];
-  if (gravfield->kind != AZ_GRAV_NOTHING && gravfield->uid == uid) {
-    *gravfield_out = gravfield;
-    return true;
+void az_schedule_script(az_space_state_t *state, const az_script_t *script) {
+  if (script == NULL) return;
+  az_timer_t *timer;
+  if (!az_insert_timer(state, 0.0, &timer)) {
+    AZ_WARNING_ONCE("Failed to schedule script; array is full.\n");
+    return;
   }
-  return false;
+  timer->vm = (az_script_vm_t){ .script = script };
 }
 
-bool az_lookup_node(az_space_state_t *state, az_uid_t uid,
-                    az_node_t **node_out) {
-  const int index = az_uid_index(uid);
-  assert(0 <= index && index < AZ_ARRAY_SIZE(state->nodes));
-  az_node_t *node = &state->nodes[index];
-  if (node->kind != AZ_NODE_NOTHING && node->uid == uid) {
-    *node_out = node;
-    return true;
-  }
-  return false;
+// Return true if timer a should go off before timer b.
+static bool timer_before(const az_timer_t *a, const az_timer_t *b) {
+  return (a->due_time < b->due_time ||
+          (a->due_time == b->due_time &&
+           (int)(a->serial - b->serial) < 0));
 }
 
-bool az_lookup_wall(az_space_state_t *state, az_uid_t uid,
-                    az_wall_t **wall_out) {
-  const int index = az_uid_index(uid);
-  assert(0 <= index && index < AZ_ARRAY_SIZE(state->walls));
-  az_wall_t *wall = &state->walls[index];
-  if (wall->kind != AZ_WALL_NOTHING && wall->uid == uid) {
-    *wall_out = wall;
-    return true;
-  }
-  return false;
+bool az_insert_timer(az_space_state_t *state, double delay,
+                     az_timer_t **timer_out) {
+  assert(delay >= 0.0);
+  assert(state->num_timers >= 0);
+  if (state->num_timers >= AZ_ARRAY_SIZE(state->timers)) return false;
+  const az_timer_t new_timer = {
+    .due_time = state->timer_time + delay,
+    .serial = state->next_timer_serial++
+  };
+  // Sift the new timer up from the bottom of the heap to where it belongs.
+  int index = state->num_timers++;
+  while (index > 0) {
+    const int parent = (index - 1) / 2;
+    if (!timer_before(&new_timer, &state->timers[parent])) break;
+    state->timers[index] = state->timers[parent];
+    index = parent;
+  }
+  state->timers[index] = new_timer;
+  *timer_out = &state->timers[index];
+  return true;
 }
 
-void az_schedule_script(az_space_state_t *state, const az_script_t *script) {
-  if (script == NULL) return;
-  AZ_ARRAY_LOOP(timer, state->timers) {
-    if (timer->vm.script != NULL) continue;
-    timer->time_remaining = 0.0;
-    timer->vm = (az_script_vm_t){ .script = script };
-    return;
+bool az_pop_due_timer(az_space_state_t *state, az_script_vm_t *vm_out) {
+  if (state->num_timers <= 0 ||
+      state->timers[0].due_time > state->timer_time) return false;
+  *vm_out = state->timers[0].vm;
+  // Move the last timer to the top of the heap, then sift it down to where it
+  // belongs.
+  const az_timer_t last = state->timers[--state->num_timers];
+  const int num_timers = state->num_timers;
+  int index = 0;
+  while (true) {
+    int child = 2 * index + 1;
+    if (child >= num_timers) break;
+    if (child + 1 < num_timers &&
+        timer_before(&state->timers[child + 1], &state->timers[child])) {
+      ++child;
+    }
+    if (!timer_before(&state->timers[child], &last)) break;
+    state->timers[index] = state->timers[child];
+    index = child;
   }
-  AZ_WARNING_ONCE("Failed to schedule script; array is full.\n");
+  state->timers[index] = last;
+  return true;
 }
 
 /*===========================================================================*/
@@ -566,6 +624,14 @@ void az_circle_impact(az_space_state_t *state, double radius,
 }
 
 
+// Return true if the circle with the given center and radius might overlap
+// the axis-aligned box with the given corners.
+static bool circle_might_touch_box(az_vector_t center, double radius,
+                                   az_vector_t box_min, az_vector_t box_max) {
+  return (center.x + radius >= box_min.x && center.x - radius <= box_max.x &&
+          center.y + radius >= box_min.y && center.y - radius <= box_max.y);
+}
+
 void az_arc_circle_impact(
     az_space_state_t *state, double circle_radius,
     az_vector_t start, az_vector_t spin_center, double spin_angle,
@@ -574,11 +640,18 @@ void az_arc_circle_impact(
   impact_out->type = AZ_IMP_NOTHING;
   az_vector_t *position_out = &impact_out->position;
   az_vector_t *normal_out = &impact_out->normal;
+  // The arc tests below are expensive, so first compute a box around the
+  // whole swept arc, and skip any object whose bounding circle is outside it.
+  az_vector_t box_min, box_max;
+  az_arc_circle_bounding_box(circle_radius, start, spin_center, spin_angle,
+                             &box_min, &box_max);
 
   // Walls:
   if (!(skip_types & AZ_IMPF_WALL)) {
     AZ_ARRAY_LOOP(wall, state->walls) {
       if (wall->kind == AZ_WALL_NOTHING) continue;
+      if (!circle_might_touch_box(wall->position, wall->data->bounding_radius,
+                                  box_min, box_max)) continue;
       if (az_arc_circle_hits_wall(
               wall, circle_radius, start, spin_center, spin_angle,
               &spin_angle, position_out, normal_out)) {
@@ -592,6 +665,8 @@ void az_arc_circle_impact(
       !(skip_types & AZ_IMPF_DOOR_OUTSIDE)) {
     AZ_ARRAY_LOOP(door, state->doors) {
       if (door->kind == AZ_DOOR_NOTHING) continue;
+      if (!circle_might_touch_box(door->position, AZ_DOOR_BOUNDING_RADIUS,
+                                  box_min, box_max)) continue;
       if (!(skip_types & AZ_IMPF_DOOR_INSIDE) &&
           az_arc_circle_hits_door_inside(
               door, circle_radius, start, spin_center, spin_angle,
@@ -631,6 +706,9 @@ void az_arc_circle_impact(
       if (baddie->uid == skip_uid) continue;
       if (skip_non_wall_like_baddies &&
           !az_baddie_has_flag(baddie, AZ_BADF_WALL_LIKE)) continue;
+      if (!circle_might_touch_box(baddie->position,
+                                  baddie->data->overall_bounding_radius,
+                                  box_min, box_max)) continue;
       const az_component_data_t *component;
       if (az_arc_circle_hits_baddie(
               baddie, circle_radius, start, spin_center, spin_angle,
@@ -21,6 +21,7 @@
 #ifndef AZIMUTH_STATE_SPACE_H_
 #define AZIMUTH_STATE_SPACE_H_
 
+#include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -45,6 +46,7 @@
 #include "azimuth/state/wall.h"
 #include "azimuth/util/audio.h"
 #include "azimuth/util/clock.h"
+#include "azimuth/util/misc.h"
 #include "azimuth/util/prefs.h"
 #include "azimuth/util/vector.h"
 
@@ -67,6 +69,19 @@ typedef struct {
   az_script_vm_t vm;
 } az_countdown_t;
 
+// The baddies that a particular kind of homing weapon may target, with their
+// positions packed alongside, so that homing projectiles and auto-aiming guns
+// can pick a target without scanning the whole baddie array.  These lists are
+// rebuilt once per tick (by az_update_homing_targets), and new baddies are
+// appended as they are added.  A baddie in the list may have since been
+// killed, so consumers must resolve the entry they pick with
+// az_resolve_homing_target.
+typedef struct {
+  int num_targets;
+  az_uid_t uids[AZ_MAX_NUM_BADDIES];
+  az_vector_t positions[AZ_MAX_NUM_BADDIES];
+} az_target_list_t;
+
 /*===========================================================================*/
 
 typedef struct {
@@ -174,9 +189,25 @@ typedef struct {
   az_pickup_t pickups[100];
   az_projectile_t projectiles[250];
   az_speck_t specks[750];
-  az_timer_t timers[20];
+  // Pending script timers, kept as a binary min-heap ordered by due_time (so
+  // timers[0] is always the next to go off), along with the total time for
+  // which timers have been ticked.  Use az_insert_timer and az_pop_due_timer
+  // rather than modifying these directly.
+  az_timer_t timers[AZ_MAX_NUM_TIMERS];
+  int num_timers;
+  double timer_time;
+  unsigned int next_timer_serial;
   az_wall_t walls[AZ_MAX_NUM_WALLS];
   az_uuid_t uuids[AZ_NUM_UUID_SLOTS];
+  // Lower bounds on the index of the first empty slot in the particles and
+  // specks arrays, so that adding a bunch of them at once (e.g. when a chain
+  // of explosions goes off) doesn't rescan the same full slots every time.
+  // Particles and specks are only ever removed by az_tick_particles and
+  // az_tick_specks, which recompute these.
+  int first_free_particle, first_free_speck;
+  // Baddies that homing projectiles, homing beams, and homing phase shots can
+  // target (i.e. that lack NO_HOMING_PROJ/BEAM/PHASE, respectively):
+  struct { az_target_list_t proj, beam, phase; } homing_targets;
 } az_space_state_t;
 
 /*===========================================================================*/
@@ -226,27 +257,102 @@ az_pickup_t *az_add_random_pickup(az_space_state_t *state,
                                   az_pickup_flags_t potential_pickups,
                                   az_vector_t position);
 
+// Rebuild state->homing_targets from the current baddies, leaving out
+// incorporeal ones.  This should be called after baddies are ticked (since
+// that's when their temporary properties, including NO_HOMING flags, are set).
+void az_update_homing_targets(az_space_state_t *state);
+
+// Look up the baddie for the given entry of a homing target list, store it in
+// *baddie_out, and return true.  If that baddie no longer exists, instead
+// remove the entry from the list (keeping the other entries in order) and
+// return false.
+bool az_resolve_homing_target(az_space_state_t *state, az_target_list_t *list,
+                              int index, az_baddie_t **baddie_out);
+
 // Gets the camera bounds for the current room.
 const az_camera_bounds_t *az_current_camera_bounds(
     const az_space_state_t *state);
 
 // Look up the specified object based on its UID and return true, or return
-// false if the object with that UID doesn't currently exist.
-bool az_lookup_baddie(az_space_state_t *state, az_uid_t uid,
-                      az_baddie_t **baddie_out);
-bool az_lookup_door(az_space_state_t *state, az_uid_t uid,
-                    az_door_t **door_out);
-bool az_lookup_gravfield(az_space_state_t *state, az_uid_t uid,
-                         az_gravfield_t **gravfield_out);
-bool az_lookup_node(az_space_state_t *state, az_uid_t uid,
-                    az_node_t **node_out);
-bool az_lookup_wall(az_space_state_t *state, az_uid_t uid,
-                    az_wall_t **wall_out);
+// false if the object with that UID doesn't currently exist.  Since every UID
+// records its object's array index, this is just an indexed load and a
+// comparison, so these are defined inline (az_lookup_object uses them too).
+static inline bool az_lookup_baddie(az_space_state_t *state, az_uid_t uid,
+                                    az_baddie_t **baddie_out) {
+  const int index = az_uid_index(uid);
+  assert(0 <= index && index < AZ_ARRAY_SIZE(state->baddies));
+  az_baddie_t *baddie = &state->baddies[index];
+  if (baddie->kind != AZ_BAD_NOTHING && baddie->uid == uid) {
+    *baddie_out = baddie;
+    return true;
+  }
+  return false;
+}
+
+static inline bool az_lookup_door(az_space_state_t *state, az_uid_t uid,
+                                  az_door_t **door_out) {
+  const int index = az_uid_index(uid);
+  assert(0 <= index && index < AZ_ARRAY_SIZE(state->doors));
+  az_door_t *door = &state->doors[index];
+  if (door->kind != AZ_DOOR_NOTHING && door->uid == uid) {
+    *door_out = door;
+    return true;
+  }
+  return false;
+}
+
+static inline bool az_lookup_gravfield(az_space_state_t *state, az_uid_t uid,
+                                       az_gravfield_t **gravfield_out) {
+  const int index = az_uid_index(uid);
+  assert(0 <= index && index < AZ_ARRAY_SIZE(state->gravfields));
+  az_gravfield_t *gravfield = &state->gravfields[index];
+  if (gravfield->kind != AZ_GRAV_NOTHING && gravfield->uid == uid) {
+    *gravfield_out = gravfield;
+    return true;
+  }
+  return false;
+}
+
+static inline bool az_lookup_node(az_space_state_t *state, az_uid_t uid,
+                                  az_node_t **node_out) {
+  const int index = az_uid_index(uid);
+  assert(0 <= index && index < AZ_ARRAY_SIZE(state->nodes));
+  az_node_t *node = &state->nodes[index];
+  if (node->kind != AZ_NODE_NOTHING && node->uid == uid) {
+    *node_out = node;
+    return true;
+  }
+  return false;
+}
+
+static inline bool az_lookup_wall(az_space_state_t *state, az_uid_t uid,
+                                  az_wall_t **wall_out) {
+  const int index = az_uid_index(uid);
+  assert(0 <= index && index < AZ_ARRAY_SIZE(state->walls));
+  az_wall_t *wall = &state->walls[index];
+  if (wall->kind != AZ_WALL_NOTHING && wall->uid == uid) {
+    *wall_out = wall;
+    return true;
+  }
+  return false;
+}
 
 // Schedule the script to run as soon as possible.  Does nothing if the script
 // is NULL.
 void az_schedule_script(az_space_state_t *state, const az_script_t *script);
 
+// Add a new timer that will go off once timers have been ticked for delay more
+// seconds, and store a pointer to it in *timer_out so that the caller can fill
+// in its VM.  The pointer is only valid until the next timer is added or
+// removed.  Returns false if there are already too many timers.
+bool az_insert_timer(az_space_state_t *state, double delay,
+                     az_timer_t **timer_out);
+
+// If any timer is due (that is, its due_time is no later than timer_time),
+// remove the earliest one, store its VM in *vm_out, and return true.
+// Otherwise, return false.  This takes constant time if nothing is due.
+bool az_pop_due_timer(az_space_state_t *state, az_script_vm_t *vm_out);
+
 /*===========================================================================*/
 
 typedef enum {
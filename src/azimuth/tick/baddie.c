@@ -833,6 +833,7 @@ void az_tick_baddies(az_space_state_t *state, double time) {
     assert(baddie->health > 0.0);
     tick_baddie(state, baddie, time);
   }
+  az_update_homing_targets(state);
 }
 
 /*===========================================================================*/
@@ -214,16 +214,27 @@ void az_snake_towards(
   baddie->param = AZ_TWO_PI + az_mod2pi(baddie->param + AZ_TWO_PI * time);
 }
 
-static void apply_walls_to_force_field(
-    az_space_state_t *state, az_baddie_t *baddie,
+// A wall's contribution to a baddie's force field falls off as exp(-dist), so
+// beyond this distance it is tiny next to any nearby wall or goal, and we can
+// skip the (comparatively expensive) vector math for that wall.  This matters
+// for rooms full of flying baddies, since each one checks every wall in the
+// room every tick.
+#define FORCE_FIELD_WALL_CUTOFF 30.0
+
+static void add_walls_to_force_field(
+    az_space_state_t *state, az_baddie_t *baddie, bool use_cutoff,
     double wall_far_coeff, double wall_near_coeff, az_vector_t *drift) {
   const az_vector_t pos = baddie->position;
+  const double baddie_radius = baddie->data->overall_bounding_radius;
   AZ_ARRAY_LOOP(door, state->doors) {
     if (door->kind == AZ_DOOR_NOTHING) continue;
     if (door->kind == AZ_DOOR_FORCEFIELD && door->openness >= 1.0) continue;
+    if (use_cutoff &&
+        !az_vwithin(pos, door->position, AZ_DOOR_BOUNDING_RADIUS +
+                    baddie_radius + FORCE_FIELD_WALL_CUTOFF)) continue;
     const az_vector_t delta = az_vsub(pos, door->position);
-    const double dist = az_vnorm(delta) - AZ_DOOR_BOUNDING_RADIUS -
-      baddie->data->overall_bounding_radius;
+    const double dist =
+      az_vnorm(delta) - AZ_DOOR_BOUNDING_RADIUS - baddie_radius;
     if (dist <= 0.0) {
       az_vpluseq(drift, az_vwithlen(delta, wall_near_coeff));
     } else {
@@ -232,9 +243,12 @@ static void apply_walls_to_force_field(
   }
   AZ_ARRAY_LOOP(wall, state->walls) {
     if (wall->kind == AZ_WALL_NOTHING) continue;
+    if (use_cutoff &&
+        !az_vwithin(pos, wall->position, wall->data->bounding_radius +
+                    baddie_radius + FORCE_FIELD_WALL_CUTOFF)) continue;
     const az_vector_t delta = az_vsub(pos, wall->position);
-    const double dist = az_vnorm(delta) - wall->data->bounding_radius -
-      baddie->data->overall_bounding_radius;
+    const double dist =
+      az_vnorm(delta) - wall->data->bounding_radius - baddie_radius;
     if (dist <= 0.0) {
       az_vpluseq(drift, az_vwithlen(delta, wall_near_coeff));
     } else {
@@ -243,6 +257,22 @@ static void apply_walls_to_force_field(
   }
 }
 
+static void apply_walls_to_force_field(
+    az_space_state_t *state, az_baddie_t *baddie,
+    double wall_far_coeff, double wall_near_coeff, az_vector_t *drift) {
+  const az_vector_t initial_drift = *drift;
+  add_walls_to_force_field(state, baddie, true, wall_far_coeff,
+                           wall_near_coeff, drift);
+  // Flying baddies steer by the direction of the drift, not its size, so even
+  // the tiny pull of distant walls matters when nothing else contributes.  In
+  // that (rare) case, redo the sum without the cutoff.
+  if (!az_vnonzero(*drift)) {
+    *drift = initial_drift;
+    add_walls_to_force_field(state, baddie, false, wall_far_coeff,
+                             wall_near_coeff, drift);
+  }
+}
+
 static az_vector_t force_field_to_ship(
     az_space_state_t *state, az_baddie_t *baddie,
     double ship_coeff, double ship_min_range, double ship_max_range,
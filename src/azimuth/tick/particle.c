@@ -22,6 +22,7 @@
 #include "azimuth/state/particle.h"
 #include "azimuth/state/space.h"
 #include "azimuth/util/misc.h"
+#include "azimuth/util/vector.h"
 
 /*===========================================================================*/
 
@@ -36,8 +37,13 @@ void az_tick_particle(az_particle_t *particle, double time) {
 }
 
 void az_tick_particles(az_space_state_t *state, double time) {
+  state->first_free_particle = AZ_ARRAY_SIZE(state->particles);
   AZ_ARRAY_LOOP(particle, state->particles) {
     az_tick_particle(particle, time);
+    if (particle->kind == AZ_PAR_NOTHING) {
+      state->first_free_particle = az_imin(state->first_free_particle,
+                                           particle - state->particles);
+    }
   }
 }
 
@@ -267,6 +267,38 @@ static void on_projectile_hit_wall(az_space_state_t *state,
   proj->kind = AZ_PROJ_NOTHING;
 }
 
+// Find the baddie that a homing projectile fired by the ship, currently headed
+// at the given angle, should go after (favoring baddies that are close and
+// roughly in front of it), store its position in *goal_out, and return true;
+// or return false if there are no targets.
+static bool find_homing_target(az_space_state_t *state,
+                               const az_projectile_t *proj, double angle,
+                               az_vector_t *goal_out) {
+  az_target_list_t *targets = &state->homing_targets.proj;
+  while (true) {
+    int best_index = -1;
+    double best_dist = INFINITY;
+    for (int i = 0; i < targets->num_targets; ++i) {
+      if (targets->uids[i] == proj->last_hit_uid) continue;
+      const az_vector_t delta = az_vsub(targets->positions[i], proj->position);
+      const double dist = az_vnorm(delta) +
+        fabs(az_mod2pi(az_vtheta(delta) - angle)) * 100.0;
+      if (dist < best_dist) {
+        best_dist = dist;
+        best_index = i;
+      }
+    }
+    if (best_index < 0) return false;
+    // If the best target has been killed since the list was built, it gets
+    // dropped from the list, and we try again.
+    az_baddie_t *baddie;
+    if (az_resolve_homing_target(state, targets, best_index, &baddie)) {
+      *goal_out = baddie->position;
+      return true;
+    }
+  }
+}
+
 // Common projectile impact code, called by both on_projectile_hit_baddie and
 // on_projectile_hit_ship.
 static void on_projectile_hit_target(
@@ -282,19 +314,9 @@ static void on_projectile_hit_target(
   // another target.
   if (proj->kind == AZ_PROJ_MISSILE_PIERCE) {
     if (proj->param < 4) {
-      const double old_proj_angle = proj->angle;
-      double best_dist = INFINITY;
-      AZ_ARRAY_LOOP(baddie, state->baddies) {
-        if (baddie->kind == AZ_BAD_NOTHING) continue;
-        if (baddie->uid == proj->last_hit_uid) continue;
-        if (az_baddie_has_flag(baddie, AZ_BADF_NO_HOMING_PROJ)) continue;
-        const double dist = az_vdist(baddie->position, proj->position) +
-          fabs(az_mod2pi(az_vtheta(az_vsub(baddie->position, proj->position)) -
-                         old_proj_angle)) * 100.0;
-        if (dist < best_dist) {
-          best_dist = dist;
-          proj->angle = az_vtheta(az_vsub(baddie->position, proj->position));
-        }
+      az_vector_t goal;
+      if (find_homing_target(state, proj, proj->angle, &goal)) {
+        proj->angle = az_vtheta(az_vsub(goal, proj->position));
       }
       proj->velocity = az_vpolar(az_vnorm(proj->velocity) - 50.0, proj->angle);
       ++proj->param;
@@ -359,20 +381,7 @@ static void projectile_home_in(az_space_state_t *state,
       goal = state->ship.position;
     }
   } else {
-    double best_dist = INFINITY;
-    AZ_ARRAY_LOOP(baddie, state->baddies) {
-      if (baddie->kind == AZ_BAD_NOTHING) continue;
-      if (baddie->uid == proj->last_hit_uid) continue;
-      if (az_baddie_has_flag(baddie, AZ_BADF_NO_HOMING_PROJ)) continue;
-      const double dist = az_vdist(baddie->position, proj->position) +
-        fabs(az_mod2pi(az_vtheta(az_vsub(baddie->position, proj->position)) -
-                       proj->angle)) * 100.0;
-      if (dist < best_dist) {
-        best_dist = dist;
-        found_target = true;
-        goal = baddie->position;
-      }
-    }
+    found_target = find_homing_target(state, proj, proj->angle, &goal);
   }
   if (!found_target) return;
   // Now, home in on the goal position.
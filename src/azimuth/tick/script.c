@@ -1011,13 +1011,12 @@ static void run_vm(az_space_state_t *state, az_script_vm_t *vm) {
             }
             SUSPEND(&state->sync_vm);
           }
-          AZ_ARRAY_LOOP(timer, state->timers) {
-            if (timer->vm.script != NULL) continue;
-            timer->time_remaining = wait_duration;
-            disable_skips(state);
-            SUSPEND(&timer->vm);
+          az_timer_t *timer;
+          if (!az_insert_timer(state, wait_duration, &timer)) {
+            SCRIPT_ERROR("too many timers");
           }
-          SCRIPT_ERROR("too many timers");
+          disable_skips(state);
+          SUSPEND(&timer->vm);
         }
       } break;
       case AZ_OP_DOOM:
@@ -1098,16 +1097,18 @@ void az_resume_script(az_space_state_t *state, az_script_vm_t *vm) {
 /*===========================================================================*/
 
 void az_tick_timers(az_space_state_t *state, double time) {
-  AZ_ARRAY_LOOP(timer, state->timers) {
-    if (timer->vm.script == NULL) continue;
-    assert(timer->time_remaining >= 0.0);
-    timer->time_remaining -= time;
-    if (timer->time_remaining <= 0.0) {
-      timer->time_remaining = 0.0;
-      if (state->sync_vm.script == NULL) {
-        az_resume_script(state, &timer->vm);
-      }
-    }
+  state->timer_time += time;
+  // Resume due timers in the order they went off.  Any timers that come due
+  // while a script is synchronously suspended stay in the queue until it's
+  // done.  Timers added by the scripts we resume here (which always sort
+  // after those already due) wait for the next tick, so that a chain of
+  // scripts scheduling each other can't keep this loop going forever.
+  const unsigned int first_new_serial = state->next_timer_serial;
+  az_script_vm_t vm;
+  while (state->sync_vm.script == NULL && state->num_timers > 0 &&
+         (int)(state->timers[0].serial - first_new_serial) < 0 &&
+         az_pop_due_timer(state, &vm)) {
+    az_resume_script(state, &vm);
   }
 }
 
@@ -397,24 +397,33 @@ static double ordn_power_mult(const az_player_t *player) {
           AZ_HIGH_EXPLOSIVES_POWER_MULTIPLIER : 1.0);
 }
 
-static double auto_aim_angle(const az_space_state_t *state, double limit,
-                             az_baddie_flags_t ignore_flag) {
+static double auto_aim_angle(az_space_state_t *state, double limit,
+                             az_target_list_t *targets) {
   const az_vector_t start =
     az_vadd(state->ship.position, az_vpolar(18, state->ship.angle));
   const double forward = state->ship.angle;
   double best_dist = INFINITY;
   double best_angle = forward;
-  AZ_ARRAY_LOOP(baddie, state->baddies) {
-    if (baddie->kind == AZ_BAD_NOTHING) continue;
-    if (az_baddie_has_flag(baddie, ignore_flag)) continue;
-    const az_vector_t delta = az_vsub(baddie->position, start);
-    const double dist = az_vnorm(delta);
-    if (dist >= best_dist) continue;
-    const double angle = az_vtheta(delta);
-    if (fabs(az_mod2pi(angle - forward)) <= limit) {
-      best_dist = dist;
-      best_angle = angle;
+  while (true) {
+    int best_index = -1;
+    for (int i = 0; i < targets->num_targets; ++i) {
+      const az_vector_t delta = az_vsub(targets->positions[i], start);
+      const double dist = az_vnorm(delta);
+      if (dist >= best_dist) continue;
+      if (fabs(az_mod2pi(az_vtheta(delta) - forward)) <= limit) {
+        best_dist = dist;
+        best_index = i;
+      }
     }
+    if (best_index < 0) break;
+    // If the best target has been killed since the list was built, it gets
+    // dropped from the list, and we try again.
+    az_baddie_t *baddie;
+    if (az_resolve_homing_target(state, targets, best_index, &baddie)) {
+      best_angle = az_vtheta(az_vsub(baddie->position, start));
+      break;
+    }
+    best_dist = INFINITY;
   }
   AZ_ARRAY_LOOP(door, state->doors) {
     if (door->kind != AZ_DOOR_NORMAL) continue;
@@ -552,7 +561,7 @@ static void fire_beam(az_space_state_t *state, az_gun_t minor, double time) {
       else if (beam_index == 2) beam_angle -= AZ_DEG2RAD(10);
     } else if (minor == AZ_GUN_HOMING) {
       beam_angle = auto_aim_angle(state, AZ_DEG2RAD(60),
-                                  AZ_BADF_NO_HOMING_BEAM);
+                                  &state->homing_targets.beam);
     }
 
     // Determine what the beam hits (if anything).
@@ -906,12 +915,13 @@ static void fire_weapons(az_space_state_t *state, double time) {
           fire_gun_multi(state, 3.0, AZ_PROJ_GUN_PHASE, AZ_TRIPLE_DAMAGE_MULT,
                          45, AZ_DEG2RAD(1), 0, AZ_SND_FIRE_GUN_NORMAL);
           return;
-        case AZ_GUN_HOMING:
+        case AZ_GUN_HOMING: {
+          const double aim_angle = auto_aim_angle(
+              state, AZ_DEG2RAD(120), &state->homing_targets.phase);
           fire_gun_multi(state, 2.0, AZ_PROJ_GUN_PHASE, 1.0, 12, AZ_DEG2RAD(1),
-                         az_mod2pi(auto_aim_angle(state, AZ_DEG2RAD(120),
-                                                  AZ_BADF_NO_HOMING_PHASE) -
-                                   ship->angle), AZ_SND_FIRE_GUN_NORMAL);
-          return;
+                         az_mod2pi(aim_angle - ship->angle),
+                         AZ_SND_FIRE_GUN_NORMAL);
+        } return;
         default: AZ_ASSERT_UNREACHABLE();
       }
     case AZ_GUN_BURST:
@@ -22,6 +22,7 @@
 #include "azimuth/state/space.h"
 #include "azimuth/state/speck.h"
 #include "azimuth/util/misc.h"
+#include "azimuth/util/vector.h"
 
 /*===========================================================================*/
 
@@ -33,8 +34,13 @@ void az_tick_speck(az_speck_t *speck, double time) {
 }
 
 void az_tick_specks(az_space_state_t *state, double time) {
+  state->first_free_speck = AZ_ARRAY_SIZE(state->specks);
   AZ_ARRAY_LOOP(speck, state->specks) {
     az_tick_speck(speck, time);
+    if (speck->kind == AZ_SPECK_NOTHING) {
+      state->first_free_speck = az_imin(state->first_free_speck,
+                                        speck - state->specks);
+    }
   }
 }
 
@@ -0,0 +1,131 @@
+/*=============================================================================
+| Copyright 2012 Matthew D. Steele <mdsteele@alum.mit.edu>                    |
+|                                                                             |
+| This file is part of Azimuth.                                               |
+|                                                                             |
+| Azimuth is free software: you can redistribute it and/or modify it under    |
+| the terms of the GNU General Public License as published by the Free        |
+| Software Foundation, either version 3 of the License, or (at your option)   |
+| any later version.                                                          |
+|                                                                             |
+| Azimuth is distributed in the hope that it will be useful, but WITHOUT      |
+| ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or       |
+| FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for   |
+| more details.                                                               |
+|                                                                             |
+| You should have received a copy of the GNU General Public License along     |
+| with Azimuth.  If not, see <http://www.gnu.org/licenses/>.                  |
+=============================================================================*/
+
+#include "azimuth/util/pacer.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "azimuth/util/misc.h"
+#include "azimuth/util/vector.h"
+
+/*===========================================================================*/
+
+// If a swap blocks for at least this fraction of the display period, we count
+// it as a vote that vsync is working:
+#define VSYNC_BLOCK_FRACTION 4
+// We change our minds about whether vsync is working only once the votes have
+// swung this far one way or the other, so that a single odd frame doesn't
+// make us flip back and forth:
+#define VSYNC_VOTE_THRESHOLD 8
+// We'll trust vsync to pace us if it's at most this much faster than the
+// period we want:
+#define VSYNC_TOLERANCE_NANOS 500000u
+
+void az_init_pacer(az_pacer_t *pacer, uint64_t period) {
+  assert(period > 0);
+  AZ_ZERO_OBJECT(pacer);
+  pacer->period = period;
+}
+
+void az_set_pacer_period(az_pacer_t *pacer, uint64_t period) {
+  assert(period > 0);
+  if (period == pacer->period) return;
+  pacer->period = period;
+  pacer->deadline = 0;
+  // The display refreshes just as fast as it did before, so keep the period
+  // we measured for it, but whether we can trust vsync to pace us depends on
+  // the new period, so confirm that again before relying on it.
+  pacer->vsync_effective = false;
+}
+
+// Return true if vsync is working and will keep us from presenting frames any
+// faster than the desired period.  If we don't yet know how fast the display
+// refreshes, we let vsync pace us until we've measured it.
+static bool paced_by_vsync(const az_pacer_t *pacer) {
+  return (pacer->vsync_effective &&
+          (pacer->display_period == 0 ||
+           pacer->display_period + VSYNC_TOLERANCE_NANOS >= pacer->period));
+}
+
+uint64_t az_pacer_next_deadline(const az_pacer_t *pacer) {
+  return (paced_by_vsync(pacer) ? 0 : pacer->deadline);
+}
+
+void az_pacer_frame_presented(az_pacer_t *pacer, uint64_t swap_start,
+                              uint64_t swap_end) {
+  assert(swap_end >= swap_start);
+  const bool waited = (az_pacer_next_deadline(pacer) != 0);
+  // Record the time since the last frame was delivered.
+  if (pacer->last_swap_end != 0) {
+    assert(swap_end >= pacer->last_swap_end);
+    const uint64_t interval = swap_end - pacer->last_swap_end;
+    const uint64_t bucket = interval / AZ_PACER_BUCKET_NANOS;
+    ++pacer->histogram[bucket < AZ_PACER_NUM_BUCKETS ? bucket :
+                       AZ_PACER_NUM_BUCKETS - 1];
+    ++pacer->num_frames;
+    // A frame that arrives more than half a frame late counts as missed.
+    const uint64_t expected =
+      (paced_by_vsync(pacer) ? pacer->display_period : pacer->period);
+    if (2 * interval > 3 * expected) ++pacer->num_missed;
+    // While vsync is pacing us, keep a running average of the time between
+    // swaps, ignoring intervals that are way out of line (e.g. because we were
+    // off doing something else entirely for a while).  We mustn't learn from
+    // swaps that we waited for ourselves, since those intervals measure our
+    // own period rather than the display's.
+    if (!waited && pacer->vsync_effective) {
+      if (pacer->display_period == 0) {
+        pacer->display_period = interval;
+      } else if (interval < 3 * pacer->display_period) {
+        pacer->display_period = (7 * pacer->display_period + interval) / 8;
+      }
+    }
+  }
+  pacer->last_swap_end = swap_end;
+  // Decide whether vsync is blocking our swaps.
+  const uint64_t reference =
+    (pacer->display_period != 0 ? pacer->display_period : pacer->period);
+  if (swap_end - swap_start >= reference / VSYNC_BLOCK_FRACTION) {
+    pacer->vsync_votes = az_imin(pacer->vsync_votes + 1, VSYNC_VOTE_THRESHOLD);
+    if (pacer->vsync_votes == VSYNC_VOTE_THRESHOLD) {
+      pacer->vsync_effective = true;
+    }
+  } else {
+    pacer->vsync_votes =
+      az_imax(pacer->vsync_votes - 1, -VSYNC_VOTE_THRESHOLD);
+    if (pacer->vsync_votes == -VSYNC_VOTE_THRESHOLD) {
+      pacer->vsync_effective = false;
+    }
+  }
+  // Schedule the next swap one period after this one was due.  If we started
+  // this one more than half a period late, then rather than trying to catch up
+  // by rushing out the next few frames (which would look worse than the one
+  // hitch), start counting again from now.  Likewise if we didn't wait for
+  // this swap at all, since then there was no schedule to keep (and if vsync
+  // was pacing us faster than our period, the old deadline has run ahead).
+  if (!waited || pacer->deadline == 0 ||
+      swap_start > pacer->deadline + pacer->period / 2) {
+    pacer->deadline = swap_start + pacer->period;
+  } else {
+    pacer->deadline += pacer->period;
+  }
+}
+
+/*===========================================================================*/
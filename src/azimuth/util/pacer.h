@@ -0,0 +1,74 @@
+/*=============================================================================
+| Copyright 2012 Matthew D. Steele <mdsteele@alum.mit.edu>                    |
+|                                                                             |
+| This file is part of Azimuth.                                               |
+|                                                                             |
+| Azimuth is free software: you can redistribute it and/or modify it under    |
+| the terms of the GNU General Public License as published by the Free        |
+| Software Foundation, either version 3 of the License, or (at your option)   |
+| any later version.                                                          |
+|                                                                             |
+| Azimuth is distributed in the hope that it will be useful, but WITHOUT      |
+| ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or       |
+| FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for   |
+| more details.                                                               |
+|                                                                             |
+| You should have received a copy of the GNU General Public License along     |
+| with Azimuth.  If not, see <http://www.gnu.org/licenses/>.                  |
+=============================================================================*/
+
+#pragma once
+#ifndef AZIMUTH_UTIL_PACER_H_
+#define AZIMUTH_UTIL_PACER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*===========================================================================*/
+
+// The frame-time histogram has one bucket per millisecond, with the last
+// bucket also counting all frames that took longer than that.
+#define AZ_PACER_NUM_BUCKETS 40
+#define AZ_PACER_BUCKET_NANOS 1000000u
+
+// Keeps track of when frames should be presented, so that they can be
+// delivered at an even rate.  The pacer itself never looks at the clock;
+// instead, the caller reports when each buffer swap started and finished, and
+// asks the pacer when the next one should start.
+//
+// If swapping buffers consistently blocks for a good fraction of a frame, then
+// vsync must be working, and (so long as the display isn't refreshing any
+// faster than we want to draw) there's no need to wait for the deadline
+// ourselves; doing so would just risk waiting for the timer and then for
+// vsync on top of that.
+typedef struct {
+  uint64_t period; // desired time between frames, in nanoseconds
+  uint64_t deadline; // when to start the next swap, or zero if not yet known
+  uint64_t last_swap_end; // when the last swap finished, or zero if none yet
+  uint64_t display_period; // average refresh period, or zero if not known
+  int vsync_votes;
+  bool vsync_effective;
+  unsigned long num_frames;
+  unsigned long num_missed; // frames delivered more than half a frame late
+  unsigned long histogram[AZ_PACER_NUM_BUCKETS];
+} az_pacer_t;
+
+// Reset the pacer to aim for the given time between frames.
+void az_init_pacer(az_pacer_t *pacer, uint64_t period);
+
+// Change the time between frames, without forgetting the histogram data or
+// the display's refresh period measured so far (though we'll need to confirm
+// that vsync is working again before letting it pace us).
+void az_set_pacer_period(az_pacer_t *pacer, uint64_t period);
+
+// Return the time at which the next buffer swap should start, or zero if we
+// should swap right away and let vsync do the waiting.
+uint64_t az_pacer_next_deadline(const az_pacer_t *pacer);
+
+// Report that a buffer swap started and finished at the given times.
+void az_pacer_frame_presented(az_pacer_t *pacer, uint64_t swap_start,
+                              uint64_t swap_end);
+
+/*===========================================================================*/
+
+#endif // AZIMUTH_UTIL_PACER_H_
@@ -23,7 +23,9 @@
 #include <math.h>
 #include <stdbool.h>
 #include <stddef.h> // for NULL
+#include <stdlib.h> // for free
 
+#include "azimuth/util/misc.h"
 #include "azimuth/util/vector.h"
 
 /*===========================================================================*/
@@ -48,9 +50,284 @@ static bool circle_touches_line_segment_internal(
           az_vdot(seg, az_vsub(center, p2)) <= 0.0);
 }
 
+// Return the cross product of the edge from v1 to v2 with the vector from v1
+// to the point; this is positive if the point is to the left of the edge.
+static double edge_cross(az_vector_t v1, az_vector_t v2, az_vector_t point) {
+  return ((v2.x - v1.x) * (point.y - v1.y) -
+          (v2.y - v1.y) * (point.x - v1.x));
+}
+
+// Return true if a ray or circle travelling along delta could first touch the
+// edge from v1 to v2 of a convex polygon with the given winding; that is, if
+// the edge doesn't face away from delta.
+static bool edge_faces(int winding, az_vector_t v1, az_vector_t v2,
+                       az_vector_t delta) {
+  return (winding * ((v2.y - v1.y) * delta.x - (v2.x - v1.x) * delta.y) <=
+          0.0);
+}
+
+// Return the total angle that the polygon turns through as we walk around it,
+// which is 2pi (or -2pi, if clockwise) for a simple polygon.
+static double total_turn(const az_vector_t *vertices, int num_vertices) {
+  double turn = 0.0;
+  for (int i = 0; i < num_vertices; ++i) {
+    const az_vector_t prev = vertices[(i + num_vertices - 1) % num_vertices];
+    const az_vector_t here = vertices[i];
+    const az_vector_t next = vertices[(i + 1) % num_vertices];
+    turn += az_mod2pi(az_vtheta(az_vsub(next, here)) -
+                      az_vtheta(az_vsub(here, prev)));
+  }
+  return turn;
+}
+
+/*===========================================================================*/
+
+void az_init_polygon_convexity(az_polygon_t *polygon) {
+  polygon->convex_winding = 0;
+  const int num_vertices = polygon->num_vertices;
+  const az_vector_t *vertices = polygon->vertices;
+  if (num_vertices < 3) return;
+  // A polygon is convex if it turns the same way at every vertex, and winds
+  // around exactly once (which rules out self-intersecting stars).
+  int winding = 0;
+  for (int i = 0; i < num_vertices; ++i) {
+    const az_vector_t prev = vertices[(i + num_vertices - 1) % num_vertices];
+    const az_vector_t here = vertices[i];
+    const az_vector_t next = vertices[(i + 1) % num_vertices];
+    const double cross = edge_cross(prev, here, next);
+    if (cross != 0.0) {
+      const int sign = (cross > 0.0 ? 1 : -1);
+      if (winding == 0) winding = sign;
+      else if (sign != winding) return;
+    }
+  }
+  if (winding == 0 ||
+      fabs(fabs(total_turn(vertices, num_vertices)) - AZ_TWO_PI) > 1e-6) {
+    return;
+  }
+  polygon->convex_winding = winding;
+}
+
+/*===========================================================================*/
+
+// Return true if the triangle abc (which must be counterclockwise) is an ear
+// of the remaining polygon, that is, if no other remaining vertex lies within
+// or on the triangle.
+static bool is_ear(const az_vector_t *vertices, const int *remaining,
+                   int num_remaining, int a, int b, int c) {
+  if (edge_cross(vertices[a], vertices[b], vertices[c]) <= 0.0) return false;
+  for (int k = 0; k < num_remaining; ++k) {
+    const az_vector_t p = vertices[remaining[k]];
+    if (az_vapprox(p, vertices[a]) || az_vapprox(p, vertices[b]) ||
+        az_vapprox(p, vertices[c])) continue;
+    if (edge_cross(vertices[a], vertices[b], p) >= 0.0 &&
+        edge_cross(vertices[b], vertices[c], p) >= 0.0 &&
+        edge_cross(vertices[c], vertices[a], p) >= 0.0) return false;
+  }
+  return true;
+}
+
+// Try to merge piece q into piece p across the diagonal they share, if there
+// is one and the result would be convex.  Each piece is a counterclockwise
+// list of vertex indices, with room for up to num_vertices entries.
+static bool try_merge_pieces(const az_vector_t *vertices, int num_vertices,
+                             int *p_indices, int *p_size,
+                             const int *q_indices, int q_size) {
+  const int p_count = *p_size;
+  for (int i = 0; i < p_count; ++i) {
+    const int u = p_indices[i], v = p_indices[(i + 1) % p_count];
+    for (int j = 0; j < q_size; ++j) {
+      if (q_indices[j] != v || q_indices[(j + 1) % q_size] != u) continue;
+      // Walk around p from v to u, then around q from just after u to just
+      // before v.
+      int merged[num_vertices];
+      int num_merged = 0;
+      for (int k = 1; k <= p_count; ++k) {
+        merged[num_merged++] = p_indices[(i + k) % p_count];
+      }
+      for (int k = 2; k < q_size; ++k) {
+        merged[num_merged++] = q_indices[(j + k) % q_size];
+      }
+      assert(num_merged <= num_vertices);
+      // The merged piece can only fail to be convex at u or v.
+      const int u_pos = p_count - 1;
+      if (edge_cross(vertices[merged[u_pos - 1]], vertices[u],
+                     vertices[merged[u_pos + 1]]) < 0.0 ||
+          edge_cross(vertices[merged[num_merged - 1]], vertices[v],
+                     vertices[merged[1]]) < 0.0) return false;
+      for (int k = 0; k < num_merged; ++k) p_indices[k] = merged[k];
+      *p_size = num_merged;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void init_piece(const az_vector_t *vertices, const int *indices,
+                       int size, az_polygon_piece_t *piece) {
+  piece->num_vertices = size;
+  piece->vertices = AZ_ALLOC(2 * size, az_vector_t);
+  piece->normals = piece->vertices + size;
+  az_vector_t sum = AZ_VZERO;
+  for (int k = 0; k < size; ++k) {
+    const int a = indices[k], b = indices[(k + 1) % size];
+    piece->vertices[k] = vertices[a];
+    piece->normals[k] = az_vunit(az_vrot90ccw(az_vsub(vertices[a],
+                                                      vertices[b])));
+    sum = az_vadd(sum, vertices[a]);
+  }
+  piece->center = az_vdiv(sum, size);
+  piece->radius = 0.0;
+  for (int k = 0; k < size; ++k) {
+    piece->radius = fmax(piece->radius,
+                         az_vdist(piece->center, piece->vertices[k]));
+  }
+  piece->radius += 0.01; // small safety margin
+}
+
+void az_init_polygon_pieces(az_polygon_t *polygon) {
+  polygon->num_pieces = 0;
+  polygon->pieces = NULL;
+  polygon->edge_pieces = NULL;
+  az_init_polygon_convexity(polygon);
+  const int num_vertices = polygon->num_vertices;
+  const az_vector_t *vertices = polygon->vertices;
+  if (num_vertices < 3) return;
+  // A simple polygon winds around exactly once; if this one doesn't (e.g. it's
+  // a self-intersecting star), leave it without pieces.
+  const bool convex = (polygon->convex_winding != 0);
+  const double turn = (convex ? polygon->convex_winding * AZ_TWO_PI :
+                       total_turn(vertices, num_vertices));
+  if (fabs(fabs(turn) - AZ_TWO_PI) > 1e-6) return;
+  // List the vertex indices in counterclockwise order.
+  int remaining[num_vertices];
+  for (int i = 0; i < num_vertices; ++i) {
+    remaining[i] = (turn > 0.0 ? i : num_vertices - 1 - i);
+  }
+  // A convex polygon is its own (only) piece.  Otherwise, triangulate the
+  // polygon by ear clipping, and then greedily merge adjacent triangles back
+  // together wherever the result stays convex (Hertel-Mehlhorn); this gives
+  // at most four times the minimum number of pieces, which is plenty good.
+  const int max_pieces = (convex ? 1 : num_vertices - 2);
+  int piece_indices[max_pieces][num_vertices];
+  int piece_sizes[max_pieces];
+  int num_pieces = 0;
+  if (convex) {
+    for (int i = 0; i < num_vertices; ++i) piece_indices[0][i] = remaining[i];
+    piece_sizes[0] = num_vertices;
+    num_pieces = 1;
+  } else {
+    int num_remaining = num_vertices;
+    while (num_remaining > 3) {
+      bool clipped = false;
+      for (int k = 0; k < num_remaining; ++k) {
+        const int a = remaining[(k + num_remaining - 1) % num_remaining];
+        const int b = remaining[k];
+        const int c = remaining[(k + 1) % num_remaining];
+        if (!is_ear(vertices, remaining, num_remaining, a, b, c)) continue;
+        piece_indices[num_pieces][0] = a;
+        piece_indices[num_pieces][1] = b;
+        piece_indices[num_pieces][2] = c;
+        piece_sizes[num_pieces++] = 3;
+        for (int m = k + 1; m < num_remaining; ++m) {
+          remaining[m - 1] = remaining[m];
+        }
+        --num_remaining;
+        clipped = true;
+        break;
+      }
+      // If we couldn't find an ear (which could only happen due to rounding
+      // errors for an unusually degenerate polygon), give up.
+      if (!clipped) return;
+    }
+    for (int k = 0; k < 3; ++k) piece_indices[num_pieces][k] = remaining[k];
+    piece_sizes[num_pieces++] = 3;
+    bool merged;
+    do {
+      merged = false;
+      for (int p = 0; p < num_pieces; ++p) {
+        for (int q = p + 1; q < num_pieces; ++q) {
+          if (!try_merge_pieces(vertices, num_vertices, piece_indices[p],
+                                &piece_sizes[p], piece_indices[q],
+                                piece_sizes[q])) continue;
+          --num_pieces;
+          for (int k = 0; k < piece_sizes[num_pieces]; ++k) {
+            piece_indices[q][k] = piece_indices[num_pieces][k];
+          }
+          piece_sizes[q] = piece_sizes[num_pieces];
+          merged = true;
+          --q;
+        }
+      }
+    } while (merged);
+  }
+  polygon->num_pieces = num_pieces;
+  polygon->pieces = AZ_ALLOC(num_pieces, az_polygon_piece_t);
+  polygon->edge_pieces = AZ_ALLOC(num_vertices, int);
+  for (int p = 0; p < num_pieces; ++p) {
+    init_piece(vertices, piece_indices[p], piece_sizes[p],
+               &polygon->pieces[p]);
+    // Each piece edge joining two consecutive vertices is an edge of the
+    // polygon; the rest are internal diagonals.
+    for (int k = 0; k < piece_sizes[p]; ++k) {
+      const int a = piece_indices[p][k];
+      const int b = piece_indices[p][(k + 1) % piece_sizes[p]];
+      if ((a + 1) % num_vertices == b) polygon->edge_pieces[a] = p;
+      else if ((b + 1) % num_vertices == a) polygon->edge_pieces[b] = p;
+    }
+  }
+}
+
+void az_destroy_polygon_pieces(az_polygon_t *polygon) {
+  for (int p = 0; p < polygon->num_pieces; ++p) {
+    free(polygon->pieces[p].vertices);
+  }
+  free(polygon->pieces);
+  free(polygon->edge_pieces);
+  polygon->num_pieces = 0;
+  polygon->pieces = NULL;
+  polygon->edge_pieces = NULL;
+}
+
 /*===========================================================================*/
 
+// Point-in-polygon test for convex polygons: the point is inside if and only
+// if it's on the inner side of every edge, so we can stop at the first edge it
+// is outside of.
+static bool convex_polygon_contains(az_polygon_t polygon, az_vector_t point) {
+  const az_vector_t *vertices = polygon.vertices;
+  const int winding = polygon.convex_winding;
+  for (int i = polygon.num_vertices - 1, j = 0; i >= 0; j = i--) {
+    if (winding * edge_cross(vertices[i], vertices[j], point) < 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Likewise for a convex piece, using its precomputed outward normals.
+static bool piece_contains(const az_polygon_piece_t *piece,
+                           az_vector_t point) {
+  for (int i = 0; i < piece->num_vertices; ++i) {
+    if (az_vdot(piece->normals[i], az_vsub(point, piece->vertices[i])) > 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool az_polygon_contains(az_polygon_t polygon, az_vector_t point) {
+  if (polygon.num_pieces > 0) {
+    for (int p = 0; p < polygon.num_pieces; ++p) {
+      const az_polygon_piece_t *piece = &polygon.pieces[p];
+      if (az_vwithin(point, piece->center, piece->radius) &&
+          piece_contains(piece, point)) return true;
+    }
+    return false;
+  }
+  if (polygon.convex_winding != 0) {
+    return convex_polygon_contains(polygon, point);
+  }
   const az_vector_t *vertices = polygon.vertices;
   // We're going to do a simple ray-casting test, where we imagine casting a
   // ray from the point in the +X direction; if we intersect an even number of
@@ -123,8 +400,40 @@ bool az_circle_touches_line_segment(
           circle_touches_line_segment_internal(p1, p2, radius, center));
 }
 
+// Determine if the circle touches the convex piece.  If the circle's center
+// is more than radius outside of any edge's line, that edge separates the two,
+// so we can stop early.  Otherwise, the circle touches the piece if its center
+// is inside, or if it touches one of the edges that the center is outside of.
+static bool circle_touches_piece(const az_polygon_piece_t *piece,
+                                 double radius, az_vector_t center) {
+  bool inside = true;
+  for (int i = 0; i < piece->num_vertices; ++i) {
+    const double dist =
+      az_vdot(piece->normals[i], az_vsub(center, piece->vertices[i]));
+    if (dist > radius) return false;
+    if (dist > 0.0) inside = false;
+  }
+  if (inside) return true;
+  for (int i = piece->num_vertices - 1, j = 0; i >= 0; j = i--) {
+    if (az_vdot(piece->normals[i],
+                az_vsub(center, piece->vertices[i])) > 0.0 &&
+        az_circle_touches_line_segment(piece->vertices[i],
+                                       piece->vertices[j],
+                                       radius, center)) return true;
+  }
+  return false;
+}
+
 bool az_circle_touches_polygon(
     az_polygon_t polygon, double radius, az_vector_t center) {
+  if (polygon.num_pieces > 0) {
+    for (int p = 0; p < polygon.num_pieces; ++p) {
+      const az_polygon_piece_t *piece = &polygon.pieces[p];
+      if (az_vwithin(center, piece->center, piece->radius + radius) &&
+          circle_touches_piece(piece, radius, center)) return true;
+    }
+    return false;
+  }
   for (int i = 0; i < polygon.num_vertices; ++i) {
     if (az_vwithin(center, polygon.vertices[i], radius)) return true;
   }
@@ -169,6 +478,14 @@ static bool ray_hits_hollow_circle(
 
 bool az_ray_hits_bounding_circle(az_vector_t start, az_vector_t delta,
                                  az_vector_t center, double radius) {
+  // Common case: most rays (e.g. a projectile's movement over one tick) are
+  // short, so usually the circle doesn't even overlap the ray's bounding box,
+  // and we can reject it without solving the quadratic.
+  const az_vector_t end = az_vadd(start, delta);
+  if (center.x + radius < fmin(start.x, end.x) ||
+      center.x - radius > fmax(start.x, end.x) ||
+      center.y + radius < fmin(start.y, end.y) ||
+      center.y - radius > fmax(start.y, end.y)) return false;
   return (az_vwithin(start, center, radius) ||
           ray_hits_hollow_circle(radius, center, start, delta, NULL));
 }
@@ -237,6 +554,24 @@ bool az_ray_hits_line_segment(
   return true;
 }
 
+// For a polygon with pieces, set reachable[p] to whether a circle with the
+// given radius (or a ray, if the radius is zero) travelling delta from start
+// could touch piece p, and return false if it can't touch any of them.  For a
+// polygon without pieces, just return true.
+static bool find_reachable_pieces(
+    az_polygon_t polygon, double radius, az_vector_t start, az_vector_t delta,
+    bool *reachable) {
+  if (polygon.num_pieces == 0) return true;
+  bool any = false;
+  for (int p = 0; p < polygon.num_pieces; ++p) {
+    const az_polygon_piece_t *piece = &polygon.pieces[p];
+    reachable[p] = az_ray_hits_bounding_circle(start, delta, piece->center,
+                                               piece->radius + radius);
+    if (reachable[p]) any = true;
+  }
+  return any;
+}
+
 bool az_ray_hits_polygon(
     az_polygon_t polygon, az_vector_t start, az_vector_t delta,
     az_vector_t *point_out, az_vector_t *normal_out) {
@@ -248,10 +583,23 @@ bool az_ray_hits_polygon(
     if (normal_out != NULL) *normal_out = start;
     return true;
   }
+  // If the polygon has convex pieces, we need only check the edges of those
+  // pieces whose bounding circles the ray passes through.
+  bool reachable[polygon.num_pieces > 0 ? polygon.num_pieces : 1];
+  if (!find_reachable_pieces(polygon, 0.0, start, delta, reachable)) {
+    return false;
+  }
   bool hit = false;
   az_vector_t pos;
-  // Check if the ray hits any edges of the polygon.
+  // Check if the ray hits any edges of the polygon.  For a convex polygon, the
+  // ray can only enter through an edge facing it, so skip the others.
+  const int winding = polygon.convex_winding;
   for (int i = polygon.num_vertices - 1, j = 0; i >= 0; j = i--) {
+    if (polygon.num_pieces > 0 && !reachable[polygon.edge_pieces[i]]) {
+      continue;
+    }
+    if (winding != 0 && !edge_faces(winding, polygon.vertices[i],
+                                    polygon.vertices[j], delta)) continue;
     if (az_ray_hits_line_segment(
             polygon.vertices[i], polygon.vertices[j], start, delta,
             &pos, normal_out)) {
@@ -270,15 +618,27 @@ bool az_ray_hits_polygon_trans(
     az_polygon_t polygon, az_vector_t polygon_position, double polygon_angle,
     az_vector_t start, az_vector_t delta,
     az_vector_t *point_out, az_vector_t *normal_out) {
-  if (az_ray_hits_polygon(polygon,
-          az_vrotate(az_vsub(start, polygon_position), -polygon_angle),
-          az_vrotate(delta, -polygon_angle), point_out, normal_out)) {
+  // This is called for every wall that a projectile might hit, every tick, so
+  // compute the sine and cosine once and share them between the rotations
+  // into and out of the polygon's frame, rather than calling az_vrotate (which
+  // would recompute them each time).
+  const double c = cos(polygon_angle);
+  const double s = sin(polygon_angle);
+  const az_vector_t rel_start = az_vsub(start, polygon_position);
+  if (az_ray_hits_polygon(
+          polygon,
+          (az_vector_t){rel_start.x * c + rel_start.y * s,
+                        rel_start.y * c - rel_start.x * s},
+          (az_vector_t){delta.x * c + delta.y * s, delta.y * c - delta.x * s},
+          point_out, normal_out)) {
     if (point_out != NULL) {
-      *point_out = az_vadd(az_vrotate(*point_out, polygon_angle),
+      const az_vector_t p = *point_out;
+      *point_out = az_vadd((az_vector_t){p.x * c - p.y * s, p.y * c + p.x * s},
                            polygon_position);
     }
     if (normal_out != NULL) {
-      *normal_out = az_vrotate(*normal_out, polygon_angle);
+      const az_vector_t n = *normal_out;
+      *normal_out = (az_vector_t){n.x * c - n.y * s, n.y * c + n.x * s};
     }
     return true;
   }
@@ -408,18 +768,42 @@ bool az_circle_hits_polygon(
     if (normal_out != NULL) *normal_out = start;
     return true;
   }
+  // If the polygon has convex pieces, we need only check the corners and
+  // edges of those pieces whose bounding circles the circle could reach.
+  // Every corner of the polygon starts an edge, so it's enough to check the
+  // piece of that edge.
+  bool reachable[polygon.num_pieces > 0 ? polygon.num_pieces : 1];
+  if (!find_reachable_pieces(polygon, radius, start, delta, reachable)) {
+    return false;
+  }
   bool hit = false;
   az_vector_t pos;
   // Check if the circle hits any corners of the polygon.
   for (int i = 0; i < polygon.num_vertices; ++i) {
+    if (polygon.num_pieces > 0 && !reachable[polygon.edge_pieces[i]]) {
+      continue;
+    }
     if (az_circle_hits_point(polygon.vertices[i], radius, start, delta,
                              &pos, normal_out)) {
       hit = true;
       delta = az_vsub(pos, start);
     }
   }
-  // Check if the circle hits any edges of the polygon.
+  // Check if the circle hits any edges of the polygon.  For a convex polygon,
+  // the circle can't hit an edge facing away from its motion unless it's
+  // already touching that edge, so skip the others.
+  const int winding = polygon.convex_winding;
   for (int i = polygon.num_vertices - 1, j = 0; i >= 0; j = i--) {
+    if (polygon.num_pieces > 0 && !reachable[polygon.edge_pieces[i]]) {
+      continue;
+    }
+    if (winding != 0 &&
+        !edge_faces(winding, polygon.vertices[i], polygon.vertices[j],
+                    delta) &&
+        !circle_touches_line_segment_internal(
+            polygon.vertices[i], polygon.vertices[j], radius, start)) {
+      continue;
+    }
     if (circle_hits_line_segment_internal(
             polygon.vertices[i], polygon.vertices[j], radius, start, delta,
             &pos, normal_out)) {
@@ -467,6 +851,38 @@ bool az_arc_ray_might_hit_bounding_circle(
                                 spin_center, spin_angle, NULL, NULL, NULL);
 }
 
+void az_arc_circle_bounding_box(
+    double circle_radius, az_vector_t start, az_vector_t spin_center,
+    double spin_angle, az_vector_t *min_out, az_vector_t *max_out) {
+  assert(circle_radius >= 0.0);
+  // Start with the box around the two endpoints of the arc.
+  const az_vector_t rel_start = az_vsub(start, spin_center);
+  const az_vector_t rel_end = az_vrotate(rel_start, spin_angle);
+  az_vector_t min = {fmin(rel_start.x, rel_end.x),
+                     fmin(rel_start.y, rel_end.y)};
+  az_vector_t max = {fmax(rel_start.x, rel_end.x),
+                     fmax(rel_start.y, rel_end.y)};
+  // The arc bulges out past its endpoints wherever it crosses one of the
+  // axes, so extend the box to each axis crossing within the swept range.
+  const double spin_radius = az_vnorm(rel_start);
+  const double sweep = fabs(spin_angle);
+  const double low_theta =
+    az_vtheta(spin_angle < 0.0 ? rel_end : rel_start);
+  for (int i = 0; i < 4; ++i) {
+    const double theta = i * AZ_HALF_PI;
+    if (sweep < AZ_TWO_PI &&
+        az_mod2pi_nonneg(theta - low_theta) > sweep) continue;
+    const az_vector_t point = az_vpolar(spin_radius, theta);
+    min.x = fmin(min.x, point.x);
+    min.y = fmin(min.y, point.y);
+    max.x = fmax(max.x, point.x);
+    max.y = fmax(max.y, point.y);
+  }
+  const az_vector_t margin = {circle_radius, circle_radius};
+  *min_out = az_vsub(az_vadd(spin_center, min), margin);
+  *max_out = az_vadd(az_vadd(spin_center, max), margin);
+}
+
 bool az_arc_ray_hits_circle(
     double circle_radius, az_vector_t circle_center,
     az_vector_t start, az_vector_t spin_center, double spin_angle,
@@ -31,15 +31,59 @@
 #define AZ_INIT_POLYGON(array) \
   { .num_vertices = AZ_ARRAY_SIZE(array), .vertices = (array) }
 
+// One convex piece of a polygon that has been split up by
+// az_init_polygon_pieces.  The vertices are in counterclockwise order, and
+// normals[i] is the outward unit normal of the edge from vertices[i] to
+// vertices[i + 1] (wrapping around at the end).
+typedef struct {
+  int num_vertices;
+  az_vector_t *vertices;
+  az_vector_t *normals;
+  // The center and radius of a circle enclosing the whole piece:
+  az_vector_t center;
+  double radius;
+} az_polygon_piece_t;
+
 // Represents a closed 2D polygon.  It is usually expected that the polygon is
 // non-self-intersecting.
 typedef struct {
   int num_vertices;
   const az_vector_t *vertices;
+  // Zero if the polygon is not known to be convex; otherwise, 1 if the polygon
+  // is convex with counterclockwise winding, or -1 if it is convex with
+  // clockwise winding.  This is normally set by az_init_polygon_convexity.
+  int convex_winding;
+  // The polygon's decomposition into convex pieces (a convex polygon has just
+  // one piece), or zero/NULL if it hasn't been decomposed.  For each edge of
+  // the polygon (from vertices[i] to vertices[i + 1]), edge_pieces[i] is the
+  // index of the piece that the edge borders.  These are filled in by
+  // az_init_polygon_pieces.
+  int num_pieces;
+  az_polygon_piece_t *pieces;
+  int *edge_pieces;
 } az_polygon_t;
 
 /*===========================================================================*/
 
+// Determine whether the polygon is convex, and set its convex_winding field
+// accordingly.  Many of the functions below have faster paths for polygons
+// that are known to be convex, so this is worth calling for polygons that
+// will be tested against many times (such as wall and baddie shapes).
+void az_init_polygon_convexity(az_polygon_t *polygon);
+
+// Split the polygon into convex pieces (or a single piece, if it's already
+// convex), and precompute their edge normals and bounding circles, for use by
+// the same fast paths.  This also calls az_init_polygon_convexity.  If the
+// polygon can't be decomposed (e.g. because it is self-intersecting), it is
+// left without pieces, and the general-purpose code is used for it.  The
+// vertices must not change after this is called.
+void az_init_polygon_pieces(az_polygon_t *polygon);
+
+// Free the pieces allocated by az_init_polygon_pieces (if any).
+void az_destroy_polygon_pieces(az_polygon_t *polygon);
+
+/*===========================================================================*/
+
 // Test if the point is in the polygon.  The polygon must be
 // non-self-intersecting, but it need not be convex.
 bool az_polygon_contains(az_polygon_t polygon, az_vector_t point);
@@ -172,6 +216,15 @@ bool az_arc_ray_might_hit_bounding_circle(
     az_vector_t start, az_vector_t spin_center, double spin_angle,
     az_vector_t circle_center, double circle_radius);
 
+// Compute an axis-aligned box that contains the circle with the given radius
+// at every point as it travels from start around spin_center by spin_angle
+// radians, storing its minimum and maximum corners in *min_out and *max_out.
+// This costs a little trig up front, but then any shape whose own bounding box
+// doesn't overlap this one can be rejected without doing any more trig.
+void az_arc_circle_bounding_box(
+    double circle_radius, az_vector_t start, az_vector_t spin_center,
+    double spin_angle, az_vector_t *min_out, az_vector_t *max_out);
+
 // The following functions each determine if a circular ray, travelling from
 // start around spin_center by spin_angle radians, will ever intersect a
 // particular shape (depending on the function).  If it does, the function
@@ -40,7 +40,8 @@ void az_reset_prefs_to_defaults(az_preferences_t *prefs) {
   *prefs = (az_preferences_t){
     .music_volume = 0.8, .sound_volume = 0.8,
     .speedrun_timer = false, .fullscreen_on_startup = DEFAULT_FULLSCREEN,
-    .enable_hints = false,
+    .enable_hints = false, .low_latency_input = false,
+    .pipelined_drawing = false,
     .key_for_control = {
       [AZ_CONTROL_UP] = AZ_KEY_UP_ARROW,
       [AZ_CONTROL_DOWN] = AZ_KEY_DOWN_ARROW,
@@ -129,6 +130,12 @@ bool az_load_prefs_from_file(FILE *file, az_preferences_t *prefs_out) {
     if (strcmp(name, "eh") == 0) {
       if (!read_bool(file, &prefs.enable_hints)) return false;
     }
+    if (strcmp(name, "ll") == 0) {
+      if (!read_bool(file, &prefs.low_latency_input)) return false;
+    }
+    if (strcmp(name, "pd") == 0) {
+      if (!read_bool(file, &prefs.pipelined_drawing)) return false;
+    }
     if (strcmp(name, "uk") == 0) {
       if (!read_key(file, key_for_control, AZ_CONTROL_UP)) return false;
     }
@@ -211,12 +218,13 @@ bool az_save_prefs_to_file(const az_preferences_t *prefs, FILE *file) {
   assert(file != NULL);
   const az_key_id_t* key_for_control = prefs->key_for_control;
   return (fprintf(
-      file, "@F mv=%.03f sv=%.03f st=%d fs=%d eh=%d\n"
+      file, "@F mv=%.03f sv=%.03f st=%d fs=%d eh=%d ll=%d pd=%d\n"
       "   uk=%d dk=%d rk=%d lk=%d fk=%d ok=%d tk=%d pk=%d\n"
       "   0k=%d 1k=%d 2k=%d 3k=%d 4k=%d 5k=%d 6k=%d 7k=%d 8k=%d 9k=%d\n",
       (double)prefs->music_volume, (double)prefs->sound_volume,
       (prefs->speedrun_timer ? 1 : 0), (prefs->fullscreen_on_startup ? 1 : 0),
-      (prefs->enable_hints ? 1 : 0),
+      (prefs->enable_hints ? 1 : 0), (prefs->low_latency_input ? 1 : 0),
+      (prefs->pipelined_drawing ? 1 : 0),
       key_for_control[AZ_CONTROL_UP],
       key_for_control[AZ_CONTROL_DOWN],
       key_for_control[AZ_CONTROL_RIGHT],
@@ -57,6 +57,7 @@ typedef enum {
 typedef struct {
   float music_volume, sound_volume;
   bool speedrun_timer, fullscreen_on_startup, enable_hints;
+  bool low_latency_input, pipelined_drawing;
   az_key_id_t key_for_control[AZ_NUM_CONTROLS];
 } az_preferences_t;
 
@@ -71,4 +71,12 @@ az_vector_t az_random_point_in_circle(double radius) {
                    az_random(0, AZ_TWO_PI));
 }
 
+az_random_seed_t az_get_global_random_seed(void) {
+  return global_seed;
+}
+
+void az_set_global_random_seed(az_random_seed_t seed) {
+  global_seed = seed;
+}
+
 /*===========================================================================*/
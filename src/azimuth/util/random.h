@@ -62,6 +62,11 @@ int az_randint(int min, int max);
 // radius of the origin.
 az_vector_t az_random_point_in_circle(double radius);
 
+// Get or set the global random seed used by the above functions.  This is
+// useful for saving and restoring the complete state of a simulation.
+az_random_seed_t az_get_global_random_seed(void);
+void az_set_global_random_seed(az_random_seed_t seed);
+
 /*===========================================================================*/
 
 #endif // AZIMUTH_UTIL_RANDOM_H_
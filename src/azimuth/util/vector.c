@@ -31,11 +31,6 @@ static bool vfinite(az_vector_t v) {
   return isfinite(v.x) && isfinite(v.y);
 }
 
-bool az_vnonzero(az_vector_t v) {
-  assert(vfinite(v));
-  return (v.x != 0.0 || v.y != 0.0);
-}
-
 az_vector_t az_vpolar(double magnitude, double theta) {
   assert(isfinite(magnitude));
   assert(isfinite(theta));
@@ -43,58 +38,6 @@ az_vector_t az_vpolar(double magnitude, double theta) {
                        .y = magnitude * sin(theta)};
 }
 
-az_vector_t az_vadd(az_vector_t v1, az_vector_t v2) {
-  return (az_vector_t){.x = v1.x + v2.x, .y = v1.y + v2.y};
-}
-
-az_vector_t az_vsub(az_vector_t v1, az_vector_t v2) {
-  return (az_vector_t){.x = v1.x - v2.x, .y = v1.y - v2.y};
-}
-
-az_vector_t az_vneg(az_vector_t v) {
-  return (az_vector_t){.x = -v.x, .y = -v.y};
-}
-
-az_vector_t az_vmul(az_vector_t v, double f) {
-  assert(isfinite(f));
-  return (az_vector_t){.x = v.x * f, .y = v.y * f};
-}
-
-az_vector_t az_vdiv(az_vector_t v, double f) {
-  assert(isfinite(f));
-  assert(f != 0.0);
-  return (az_vector_t){.x = v.x / f, .y = v.y / f};
-}
-
-void az_vpluseq(az_vector_t *v1, az_vector_t v2) {
-  v1->x += v2.x;
-  v1->y += v2.y;
-}
-
-double az_vdot(az_vector_t v1, az_vector_t v2) {
-  return v1.x * v2.x + v1.y * v2.y;
-}
-
-double az_vcross(az_vector_t v1, az_vector_t v2) {
-  return v1.x * v2.y - v1.y * v2.x;
-}
-
-az_vector_t az_vproj(az_vector_t v1, az_vector_t v2) {
-  assert(vfinite(v1));
-  assert(vfinite(v2));
-  const double sqnorm = az_vdot(v2, v2);
-  if (sqnorm == 0.0) return AZ_VZERO;
-  return az_vmul(v2, az_vdot(v1, v2) / sqnorm);
-}
-
-az_vector_t az_vflatten(az_vector_t v1, az_vector_t v2) {
-  return az_vsub(v1, az_vproj(v1, v2));
-}
-
-az_vector_t az_vreflect(az_vector_t v1, az_vector_t v2) {
-  return az_vsub(v1, az_vmul(az_vflatten(v1, v2), 2));
-}
-
 az_vector_t az_vrotate(az_vector_t v, double radians) {
   assert(vfinite(v));
   assert(isfinite(radians));
@@ -103,10 +46,6 @@ az_vector_t az_vrotate(az_vector_t v, double radians) {
   return (az_vector_t){.x = v.x * c - v.y * s, .y = v.y * c + v.x * s};
 }
 
-az_vector_t az_vrot90ccw(az_vector_t v) {
-  return (az_vector_t){.x = -v.y, .y = v.x};
-}
-
 double az_vnorm(az_vector_t v) {
   assert(vfinite(v));
   return hypot(v.x, v.y);
@@ -156,13 +95,6 @@ double az_vdist(az_vector_t v1, az_vector_t v2) {
   return az_vnorm(az_vsub(v1, v2));
 }
 
-bool az_vwithin(az_vector_t v1, az_vector_t v2, double dist) {
-  assert(isfinite(dist));
-  assert(dist >= 0.0);
-  return ((v1.x - v2.x) * (v1.x - v2.x) +
-          (v1.y - v2.y) * (v1.y - v2.y) <= dist * dist);
-}
-
 /*===========================================================================*/
 
 int az_modulo(int a, int b) {
@@ -205,14 +137,6 @@ double az_angle_towards(double theta, double delta, double goal) {
                    (difference <= delta ? goal : theta - delta));
 }
 
-int az_imin(int a, int b) {
-  return a <= b ? a : b;
-}
-
-int az_imax(int a, int b) {
-  return a > b ? a : b;
-}
-
 #define EPSILON 0.00000001
 
 bool az_dapprox(double a, double b) {
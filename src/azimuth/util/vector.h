@@ -21,6 +21,8 @@
 #ifndef AZIMUTH_UTIL_VECTOR_H_
 #define AZIMUTH_UTIL_VECTOR_H_
 
+#include <assert.h>
+#include <math.h>
 #include <stdbool.h>
 
 /*===========================================================================*/
@@ -46,40 +48,80 @@ typedef struct {
 extern const az_vector_t AZ_VZERO;
 
 // Return false for the zero vector, true otherwise.
-bool az_vnonzero(az_vector_t v);
+static inline bool az_vnonzero(az_vector_t v) {
+  assert(isfinite(v.x) && isfinite(v.y));
+  return (v.x != 0.0 || v.y != 0.0);
+}
 
 // Create a vector from polar coordinates.
 az_vector_t az_vpolar(double magnitude, double theta);
 
+// The simple arithmetic functions below are defined inline, since they are
+// used in the innermost loops of collision detection and baddie AI, where the
+// cost of an out-of-line call would dwarf the arithmetic itself.  Functions
+// that call into libm (sqrt, trig, etc.) are defined in vector.c.
+
 // Add two vectors.
-az_vector_t az_vadd(az_vector_t v1, az_vector_t v2);
+static inline az_vector_t az_vadd(az_vector_t v1, az_vector_t v2) {
+  return (az_vector_t){.x = v1.x + v2.x, .y = v1.y + v2.y};
+}
 // Subtract the second vector from the first.
-az_vector_t az_vsub(az_vector_t v1, az_vector_t v2);
+static inline az_vector_t az_vsub(az_vector_t v1, az_vector_t v2) {
+  return (az_vector_t){.x = v1.x - v2.x, .y = v1.y - v2.y};
+}
 // Negate a vector.
-az_vector_t az_vneg(az_vector_t v);
+static inline az_vector_t az_vneg(az_vector_t v) {
+  return (az_vector_t){.x = -v.x, .y = -v.y};
+}
 // Multiply a vector by a scalar.
-az_vector_t az_vmul(az_vector_t v, double f);
+static inline az_vector_t az_vmul(az_vector_t v, double f) {
+  assert(isfinite(f));
+  return (az_vector_t){.x = v.x * f, .y = v.y * f};
+}
 // Divide a vector by a scalar.  The scalar must be nonzero.
-az_vector_t az_vdiv(az_vector_t v, double f);
+static inline az_vector_t az_vdiv(az_vector_t v, double f) {
+  assert(isfinite(f));
+  assert(f != 0.0);
+  return (az_vector_t){.x = v.x / f, .y = v.y / f};
+}
 // Add the second vector to the first, in place.
-void az_vpluseq(az_vector_t *v1, az_vector_t v2);
+static inline void az_vpluseq(az_vector_t *v1, az_vector_t v2) {
+  v1->x += v2.x;
+  v1->y += v2.y;
+}
 
 // Compute the dot product of the two vectors.
-double az_vdot(az_vector_t v1, az_vector_t v2);
+static inline double az_vdot(az_vector_t v1, az_vector_t v2) {
+  return v1.x * v2.x + v1.y * v2.y;
+}
 // Compute the magnitude of the cross product of the two vectors.
-double az_vcross(az_vector_t v1, az_vector_t v2);
+static inline double az_vcross(az_vector_t v1, az_vector_t v2) {
+  return v1.x * v2.y - v1.y * v2.x;
+}
 
 // Project the first vector onto the second.
-az_vector_t az_vproj(az_vector_t v1, az_vector_t v2);
+static inline az_vector_t az_vproj(az_vector_t v1, az_vector_t v2) {
+  assert(isfinite(v1.x) && isfinite(v1.y));
+  assert(isfinite(v2.x) && isfinite(v2.y));
+  const double sqnorm = az_vdot(v2, v2);
+  if (sqnorm == 0.0) return AZ_VZERO;
+  return az_vmul(v2, az_vdot(v1, v2) / sqnorm);
+}
 // Flatten the first vector with respect to the second.
-az_vector_t az_vflatten(az_vector_t v1, az_vector_t v2);
+static inline az_vector_t az_vflatten(az_vector_t v1, az_vector_t v2) {
+  return az_vsub(v1, az_vproj(v1, v2));
+}
 // Reflect the first vector across the axis of the second.
-az_vector_t az_vreflect(az_vector_t v1, az_vector_t v2);
+static inline az_vector_t az_vreflect(az_vector_t v1, az_vector_t v2) {
+  return az_vsub(v1, az_vmul(az_vflatten(v1, v2), 2));
+}
 
 // Rotate a vector counterclockwise by the given angle.
 az_vector_t az_vrotate(az_vector_t v, double radians);
 // Rotate a vector 90 degrees counterclockwise.
-az_vector_t az_vrot90ccw(az_vector_t v);
+static inline az_vector_t az_vrot90ccw(az_vector_t v) {
+  return (az_vector_t){.x = -v.y, .y = v.x};
+}
 
 // Get the length of the vector.
 double az_vnorm(az_vector_t v);
@@ -104,7 +146,12 @@ double az_vtheta(az_vector_t v);
 // Get the distance between two vectors.
 double az_vdist(az_vector_t v1, az_vector_t v2);
 // Determine if two points are within the given distance of each other.
-bool az_vwithin(az_vector_t v1, az_vector_t v2, double dist);
+static inline bool az_vwithin(az_vector_t v1, az_vector_t v2, double dist) {
+  assert(isfinite(dist));
+  assert(dist >= 0.0);
+  return ((v1.x - v2.x) * (v1.x - v2.x) +
+          (v1.y - v2.y) * (v1.y - v2.y) <= dist * dist);
+}
 
 /*===========================================================================*/
 
@@ -134,8 +181,12 @@ double az_mod2pi_nonpos(double theta);
 double az_angle_towards(double theta, double delta, double goal);
 
 // Min and max functions for ints:
-int az_imin(int a, int b);
-int az_imax(int a, int b);
+static inline int az_imin(int a, int b) {
+  return a <= b ? a : b;
+}
+static inline int az_imax(int a, int b) {
+  return a > b ? a : b;
+}
 
 // Test if two (finite) doubles are approximately equal.
 bool az_dapprox(double a, double b);
@@ -319,14 +319,14 @@ static void draw_half_stone_brick(float width, float height, float rr) {
   glBegin(GL_TRIANGLE_FAN); {
     az_gl_color(color1); glVertex2f(rr, -rr); az_gl_color(color2);
     for (int i = 90; i <= 180; i += 30) {
-      glVertex2d(rr + rr * cos(AZ_DEG2RAD(i)), -rr + rr * sin(AZ_DEG2RAD(i)));
+      glVertex2d(rr + rr * az_cos_deg(i), -rr + rr * az_sin_deg(i));
     }
   } glEnd();
   glBegin(GL_TRIANGLE_FAN); {
     az_gl_color(color1); glVertex2f(rr, -height + rr); az_gl_color(color2);
     for (int i = 180; i <= 270; i += 30) {
-      glVertex2d(rr + rr * cos(AZ_DEG2RAD(i)),
-                 -height + rr + rr * sin(AZ_DEG2RAD(i)));
+      glVertex2d(rr + rr * az_cos_deg(i),
+                 -height + rr + rr * az_sin_deg(i));
     }
   } glEnd();
 }
@@ -352,61 +352,102 @@ static void draw_half_cinderblock(float width, float height) {
   } glEnd();
 }
 
+// Bubbles are animated by varying the radius of their middle ring, which
+// cycles through NUM_BUBBLE_STEPS different sizes.  We precompile a
+// unit-radius bubble of each color for each step, and then just scale and
+// translate one of those as needed.
+#define NUM_BUBBLE_STEPS 20
+
+typedef enum {
+  GREEN_BUBBLE = 0,
+  PURPLE_BUBBLE,
+  BROWN_BUBBLE,
+  BLUE_BUBBLE,
+  NUM_BUBBLE_COLORS
+} az_bubble_color_t;
+
+// Precompiled blinkenlights (lit and unlit), for the triangle struts pattern.
+#define NUM_BLINKENLIGHT_LISTS 2
+
+// Stars in the starry night pattern twinkle by varying the length of their
+// points, which cycles through NUM_TWINKLE_STEPS different sizes.
+#define NUM_TWINKLE_STEPS 10
+#define STAR_SPACING 50
+#define NUM_STARS_HORZ 6
+#define NUM_STARS_VERT 6
+
+#define PATTERN_LISTS_INDEX 0
+#define BUBBLE_LISTS_INDEX (PATTERN_LISTS_INDEX + AZ_NUM_BG_PATTERNS)
+#define BLINKENLIGHT_LISTS_INDEX \
+  (BUBBLE_LISTS_INDEX + NUM_BUBBLE_COLORS * NUM_BUBBLE_STEPS)
+#define STAR_LISTS_INDEX (BLINKENLIGHT_LISTS_INDEX + NUM_BLINKENLIGHT_LISTS)
+#define NUM_BG_DISPLAY_LISTS (STAR_LISTS_INDEX + NUM_TWINKLE_STEPS)
+
+static GLuint bg_display_lists_start;
+
+static void compile_bubble(az_color_t inner, az_color_t mid, az_color_t outer,
+                           int step) {
+  const double mid_radius = 0.4 + 0.01 * step;
+  glBegin(GL_TRIANGLE_FAN); {
+    az_gl_color(inner);
+    glVertex2f(-0.1, 0.1);
+    az_gl_color(mid);
+    for (int i = 0; i <= 360; i += 30) {
+      az_gl_vertex_polar_deg(mid_radius, i);
+    }
+  } glEnd();
+  glBegin(GL_TRIANGLE_STRIP); {
+    for (int i = 0; i <= 360; i += 30) {
+      az_gl_color(mid);
+      az_gl_vertex_polar_deg(mid_radius, i);
+      az_gl_color(outer);
+      glVertex2d(1.5 * az_cos_deg(i), az_sin_deg(i));
+    }
+  } glEnd();
+}
+
+static void compile_bubbles(az_bubble_color_t color, az_color_t inner,
+                            az_color_t mid, az_color_t outer) {
+  for (int step = 0; step < NUM_BUBBLE_STEPS; ++step) {
+    glNewList(bg_display_lists_start + BUBBLE_LISTS_INDEX +
+              color * NUM_BUBBLE_STEPS + step, GL_COMPILE); {
+      compile_bubble(inner, mid, outer, step);
+    } glEndList();
+  }
+}
+
 static void draw_bubble(double center_x, double center_y, double radius,
-                        int slowdown, az_clock_t clock, az_color_t inner,
-                        az_color_t mid, az_color_t outer) {
-  const double mid_radius =
-    radius * (0.4 + 0.01 * az_clock_zigzag(20, slowdown, clock));
+                        int slowdown, az_clock_t clock,
+                        az_bubble_color_t color) {
+  const int step = az_clock_zigzag(NUM_BUBBLE_STEPS, slowdown, clock);
+  const GLuint display_list = bg_display_lists_start + BUBBLE_LISTS_INDEX +
+    color * NUM_BUBBLE_STEPS + step;
+  assert(glIsList(display_list));
   glPushMatrix(); {
     glTranslated(center_x, center_y, 0);
-    glBegin(GL_TRIANGLE_FAN); {
-      az_gl_color(inner);
-      glVertex2f(-0.1 * radius, 0.1 * radius);
-      az_gl_color(mid);
-      for (int i = 0; i <= 360; i += 30) {
-        glVertex2d(mid_radius * cos(AZ_DEG2RAD(i)),
-                   mid_radius * sin(AZ_DEG2RAD(i)));
-      }
-    } glEnd();
-    glBegin(GL_TRIANGLE_STRIP); {
-      for (int i = 0; i <= 360; i += 30) {
-        az_gl_color(mid);
-        glVertex2d(mid_radius * cos(AZ_DEG2RAD(i)),
-                   mid_radius * sin(AZ_DEG2RAD(i)));
-        az_gl_color(outer);
-        glVertex2d(1.5 * radius * cos(AZ_DEG2RAD(i)),
-                   radius * sin(AZ_DEG2RAD(i)));
-      }
-    } glEnd();
+    glScaled(radius, radius, 1);
+    glCallList(display_list);
   } glPopMatrix();
 }
 
 static void draw_green_bubble(double center_x, double center_y, double radius,
                               int slowdown, az_clock_t clock) {
-  draw_bubble(center_x, center_y, radius, slowdown, clock,
-              (az_color_t){51, 51, 0, 255}, (az_color_t){0, 51, 0, 255},
-              (az_color_t){0, 25, 51, 0});
+  draw_bubble(center_x, center_y, radius, slowdown, clock, GREEN_BUBBLE);
 }
 
 static void draw_purple_bubble(double center_x, double center_y, double radius,
                                int slowdown, az_clock_t clock) {
-  draw_bubble(center_x, center_y, radius, slowdown, clock,
-              (az_color_t){40, 25, 51, 255}, (az_color_t){25, 0, 51, 255},
-              (az_color_t){0, 0, 51, 0});
+  draw_bubble(center_x, center_y, radius, slowdown, clock, PURPLE_BUBBLE);
 }
 
 static void draw_brown_bubble(double center_x, double center_y, double radius,
                                int slowdown, az_clock_t clock) {
-  draw_bubble(center_x, center_y, radius, 2 * slowdown, clock,
-              (az_color_t){40, 30, 10, 255}, (az_color_t){40, 15, 0, 255},
-              (az_color_t){40, 0, 0, 0});
+  draw_bubble(center_x, center_y, radius, 2 * slowdown, clock, BROWN_BUBBLE);
 }
 
 static void draw_blue_bubble(double center_x, double center_y, double radius,
                                int slowdown, az_clock_t clock) {
-  draw_bubble(center_x, center_y, radius, 2 * slowdown, clock,
-              (az_color_t){25, 40, 51, 255}, (az_color_t){0, 25, 51, 255},
-              (az_color_t){0, 0, 51, 0});
+  draw_bubble(center_x, center_y, radius, 2 * slowdown, clock, BLUE_BUBBLE);
 }
 
 static void draw_purple_column(float center_x, double top, float semi_width,
@@ -519,32 +560,87 @@ static void draw_tree_branch(
   } glEnd();
 }
 
+static void compile_blinkenlight(bool lit) {
+  glBegin(GL_TRIANGLE_FAN); {
+    if (lit) glColor4f(0.30, 0.30, 0.15, 0.9);
+    else glColor4f(0.15, 0.15, 0.15, 0.9);
+    glVertex2f(0, 0);
+    if (lit) glColor4f(0.30, 0.30, 0.15, 0);
+    else glColor4f(0.15, 0.15, 0.15, 0);
+    for (int i = 0; i <= 360; i += 45) {
+      az_gl_vertex_polar_deg(4, i);
+    }
+  } glEnd();
+}
+
 static void draw_blinkenlight(GLfloat center_x, GLfloat center_y, bool lit) {
+  const GLuint display_list =
+    bg_display_lists_start + BLINKENLIGHT_LISTS_INDEX + (lit ? 1 : 0);
   glPushMatrix(); {
     glTranslatef(center_x, center_y, 0);
-    glBegin(GL_TRIANGLE_FAN); {
-      if (lit) glColor4f(0.30, 0.30, 0.15, 0.9);
-      else glColor4f(0.15, 0.15, 0.15, 0.9);
-      glVertex2f(0, 0);
-      if (lit) glColor4f(0.30, 0.30, 0.15, 0);
-      else glColor4f(0.15, 0.15, 0.15, 0);
-      for (int i = 0; i <= 360; i += 45) {
-        glVertex2d(4 * cos(AZ_DEG2RAD(i)), 4 * sin(AZ_DEG2RAD(i)));
-      }
-    } glEnd();
+    glCallList(display_list);
   } glPopMatrix();
 }
 
-// Draw one patch of the background pattern.  It should cover the rect from
-// <-repeat_horz/2, 0.0> to <repeat_horz/2, -repeat_vert>.
-static void draw_bg_patch(az_background_pattern_t pattern, az_clock_t clock) {
+// Compile a unit-sized star for the given twinkle step.
+static void compile_star(int step) {
+  const double twinkle = 0.5 + 0.05 * step;
+  glBegin(GL_TRIANGLE_FAN); {
+    glColor3f(0.5, 0.5, 0.5);
+    glVertex2d(0, 0);
+    glColor3f(0.1, 0.1, 0.1);
+    for (int i = 0; i <= 360; i += 45) {
+      const double rho = (i % 2 == 0 ? twinkle : 0.3);
+      az_gl_vertex_polar_deg(rho, i);
+    }
+  } glEnd();
+}
+
+// The positions and sizes of the stars in one patch of the starry night
+// pattern; these are generated once, in az_init_background_drawing.
+static struct {
+  double cx, cy, size;
+} starry_night_stars[NUM_STARS_HORZ * NUM_STARS_VERT];
+
+static void init_starry_night_stars(void) {
+  const az_background_data_t *data = &background_datas[AZ_BG_STARRY_NIGHT];
+  const int semi_width = 0.5 * data->repeat_horz;
+  const int bottom = -data->repeat_vert;
+  az_random_seed_t seed = {1, 1};
+  int index = 0;
+  for (int xoff = -semi_width; xoff < semi_width; xoff += STAR_SPACING) {
+    for (int yoff = 0; yoff > bottom; yoff -= STAR_SPACING) {
+      assert(index < AZ_ARRAY_SIZE(starry_night_stars));
+      starry_night_stars[index].size = 2 + 4 * az_rand_udouble(&seed);
+      starry_night_stars[index].cx =
+        xoff + STAR_SPACING * az_rand_udouble(&seed);
+      starry_night_stars[index].cy =
+        yoff + STAR_SPACING * az_rand_udouble(&seed);
+      ++index;
+    }
+  }
+  assert(index == AZ_ARRAY_SIZE(starry_night_stars));
+}
+
+static void draw_starry_night_stars(az_clock_t clock) {
+  int clock_offset = 0;
+  AZ_ARRAY_LOOP(star, starry_night_stars) {
+    const int step = az_clock_zigzag(NUM_TWINKLE_STEPS, 4,
+                                     clock + clock_offset);
+    glPushMatrix(); {
+      glTranslated(star->cx, star->cy, 0);
+      glScaled(star->size, star->size, 1);
+      glCallList(bg_display_lists_start + STAR_LISTS_INDEX + step);
+    } glPopMatrix();
+    clock_offset += 17;
+  }
+}
+
+// Draw the animated parts of one patch of the background pattern that go
+// underneath the static parts drawn by draw_static_bg_patch.
+static void draw_bg_patch_underlay(az_background_pattern_t pattern,
+                                   az_clock_t clock) {
   switch (pattern) {
-    case AZ_BG_SOLID_BLACK: break;
-    case AZ_BG_BROWN_ROCK_WALL: {
-      const az_color_t color1 = {48, 45, 42, 255};
-      const az_color_t color2 = {24, 18, 12, 255};
-      draw_rock_wall(color1, color2, 200, 200);
-    } break;
     case AZ_BG_GREEN_HEX_TRELLIS: {
       glPushMatrix(); {
         glScalef(140.0f / 300.0f, 180.0f / 300.0f, 1.0f);
@@ -557,6 +653,128 @@ static void draw_bg_patch(az_background_pattern_t pattern, az_clock_t clock) {
         draw_brown_bubble(40, -130, 30, 2, clock);
         draw_brown_bubble(63, -75, 27, 3, clock + 5);
       } glPopMatrix();
+    } break;
+    case AZ_BG_GREEN_BUBBLES: {
+      draw_green_bubble(0, -90, 50, 12, clock);
+      draw_green_bubble(-40, -25, 40, 10, clock);
+      draw_green_bubble(30, -40, 35, 8, clock);
+      draw_green_bubble(-55, -120, 32, 6, clock);
+      draw_green_bubble(40, -130, 30, 4, clock);
+      draw_green_bubble(63, -75, 27, 6, clock + 5);
+    } break;
+    case AZ_BG_CRYSTAL_CAVE: {
+      glBegin(GL_TRIANGLE_STRIP); {
+        const float gray = 0.003f * az_clock_zigzag(100, 1, clock);
+        glColor3f(gray, gray, gray);
+        glVertex2f(-60,    0); glVertex2f(60,    0);
+        glVertex2f(-60, -100); glVertex2f(60, -100);
+      } glEnd();
+    } break;
+    case AZ_BG_PURPLE_BUBBLES: {
+      glPushMatrix(); {
+        glScalef(2, 2, 1);
+        draw_purple_bubble(0, -90, 50, 6, clock);
+        draw_purple_bubble(-40, -25, 40, 5, clock);
+        draw_purple_bubble(30, -40, 35, 4, clock);
+        draw_purple_bubble(-55, -120, 32, 3, clock);
+        draw_purple_bubble(40, -130, 30, 2, clock);
+        draw_purple_bubble(63, -75, 27, 3, clock + 5);
+      } glPopMatrix();
+    } break;
+    case AZ_BG_BLUE_BUBBLES: {
+      glPushMatrix(); {
+        glScalef(1.5, 2, 1);
+        draw_blue_bubble(0, -90, 50, 6, clock);
+        draw_blue_bubble(-40, -25, 40, 5, clock);
+        draw_blue_bubble(30, -40, 35, 4, clock);
+        draw_blue_bubble(-55, -120, 32, 3, clock);
+        draw_blue_bubble(40, -130, 30, 2, clock);
+        draw_blue_bubble(63, -75, 27, 3, clock + 5);
+      } glPopMatrix();
+    } break;
+    default: break;
+  }
+}
+
+// Draw the animated parts of one patch of the background pattern that go on
+// top of the static parts drawn by draw_static_bg_patch.
+static void draw_bg_patch_overlay(az_background_pattern_t pattern,
+                                  az_clock_t clock) {
+  switch (pattern) {
+    case AZ_BG_TRIANGLE_STRUTS: {
+      const int phase = az_clock_mod(4, 20, clock);
+      draw_blinkenlight(-55.5,   -4, phase == 0);
+      draw_blinkenlight(-55.5, -256, phase == 0);
+      draw_blinkenlight(-18.5,   -4, phase == 1);
+      draw_blinkenlight(-18.5, -256, phase == 1);
+      draw_blinkenlight( 18.5,   -4, phase == 2);
+      draw_blinkenlight( 18.5, -256, phase == 2);
+      draw_blinkenlight( 55.5,   -4, phase == 3);
+      draw_blinkenlight( 55.5, -256, phase == 3);
+      draw_blinkenlight( 18.5, -126, phase == 0);
+      draw_blinkenlight( 18.5, -134, phase == 0);
+      draw_blinkenlight( 55.5, -126, phase == 1);
+      draw_blinkenlight( 55.5, -134, phase == 1);
+      draw_blinkenlight(-55.5, -126, phase == 2);
+      draw_blinkenlight(-55.5, -134, phase == 2);
+      draw_blinkenlight(-18.5, -126, phase == 3);
+      draw_blinkenlight(-18.5, -134, phase == 3);
+
+      draw_blinkenlight(-62.3,  -14.0, phase == 3);
+      draw_blinkenlight(-69.2,  -18.0, phase == 3);
+      draw_blinkenlight(-43.8,  -46.1, phase == 2);
+      draw_blinkenlight(-50.7,  -50.1, phase == 2);
+      draw_blinkenlight(-25.3,  -78.1, phase == 1);
+      draw_blinkenlight(-32.2,  -82.1, phase == 1);
+      draw_blinkenlight( -6.8, -110.2, phase == 0);
+      draw_blinkenlight(-13.7, -114.2, phase == 0);
+      draw_blinkenlight( 11.7, -142.2, phase == 3);
+      draw_blinkenlight(  4.8, -146.2, phase == 3);
+      draw_blinkenlight( 30.2, -174.2, phase == 2);
+      draw_blinkenlight( 23.3, -178.2, phase == 2);
+      draw_blinkenlight( 48.7, -206.3, phase == 1);
+      draw_blinkenlight( 41.8, -210.3, phase == 1);
+      draw_blinkenlight( 67.2, -238.3, phase == 0);
+      draw_blinkenlight( 60.3, -242.3, phase == 0);
+
+      draw_blinkenlight( 62.3,  -14.0, phase == 0);
+      draw_blinkenlight( 69.2,  -18.0, phase == 0);
+      draw_blinkenlight( 43.8,  -46.1, phase == 1);
+      draw_blinkenlight( 50.7,  -50.1, phase == 1);
+      draw_blinkenlight( 25.3,  -78.1, phase == 2);
+      draw_blinkenlight( 32.2,  -82.1, phase == 2);
+      draw_blinkenlight(  6.8, -110.2, phase == 3);
+      draw_blinkenlight( 13.7, -114.2, phase == 3);
+      draw_blinkenlight(-11.7, -142.2, phase == 0);
+      draw_blinkenlight( -4.8, -146.2, phase == 0);
+      draw_blinkenlight(-30.2, -174.2, phase == 1);
+      draw_blinkenlight(-23.3, -178.2, phase == 1);
+      draw_blinkenlight(-48.7, -206.3, phase == 2);
+      draw_blinkenlight(-41.8, -210.3, phase == 2);
+      draw_blinkenlight(-67.2, -238.3, phase == 3);
+      draw_blinkenlight(-60.3, -242.3, phase == 3);
+    } break;
+    case AZ_BG_STARRY_NIGHT:
+      draw_starry_night_stars(clock);
+      break;
+    default: break;
+  }
+}
+
+// Draw the static parts of one patch of the background pattern (this is
+// compiled into a display list for each pattern by
+// az_init_background_drawing).  Together with the underlay and overlay, it
+// should cover the rect from <-repeat_horz/2, 0.0> to
+// <repeat_horz/2, -repeat_vert>.
+static void draw_static_bg_patch(az_background_pattern_t pattern) {
+  switch (pattern) {
+    case AZ_BG_SOLID_BLACK: break;
+    case AZ_BG_BROWN_ROCK_WALL: {
+      const az_color_t color1 = {48, 45, 42, 255};
+      const az_color_t color2 = {24, 18, 12, 255};
+      draw_rock_wall(color1, color2, 200, 200);
+    } break;
+    case AZ_BG_GREEN_HEX_TRELLIS: {
       glPushMatrix(); {
         draw_hex_trellis();
         glTranslatef(0.0f, -104.0f, 0.0f);
@@ -650,14 +868,7 @@ static void draw_bg_patch(az_background_pattern_t pattern, az_clock_t clock) {
         draw_half_cinderblock(1.5f * half_width, height);
       } glPopMatrix();
     } break;
-    case AZ_BG_GREEN_BUBBLES: {
-      draw_green_bubble(0, -90, 50, 12, clock);
-      draw_green_bubble(-40, -25, 40, 10, clock);
-      draw_green_bubble(30, -40, 35, 8, clock);
-      draw_green_bubble(-55, -120, 32, 6, clock);
-      draw_green_bubble(40, -130, 30, 4, clock);
-      draw_green_bubble(63, -75, 27, 6, clock + 5);
-    } break;
+    case AZ_BG_GREEN_BUBBLES: break;
     case AZ_BG_PURPLE_COLUMNS: {
       draw_purple_column(-50, 0, 20, 15, false);
       draw_purple_column(50, 0, 20, 53, false);
@@ -691,12 +902,6 @@ static void draw_bg_patch(az_background_pattern_t pattern, az_clock_t clock) {
                            100, -143, 100, -180, 0, -180);
     } break;
     case AZ_BG_CRYSTAL_CAVE: {
-      glBegin(GL_TRIANGLE_STRIP); {
-        const float gray = 0.003f * az_clock_zigzag(100, 1, clock);
-        glColor3f(gray, gray, gray);
-        glVertex2f(-60,    0); glVertex2f(60,    0);
-        glVertex2f(-60, -100); glVertex2f(60, -100);
-      } glEnd();
       draw_crystal_cell(-10, -58, -20, 0, -60, -58);
       draw_crystal_cell(-60, 0, -20, 0, -60, -58);
       draw_crystal_cell(-10, -58, -20, 0, 60, -58);
@@ -716,17 +921,7 @@ static void draw_bg_patch(az_background_pattern_t pattern, az_clock_t clock) {
       draw_ice_cell(-8, -93, -16, -160, 48, -93);
       draw_ice_cell(48, -160, -16, -160, 48, -93);
     } break;
-    case AZ_BG_PURPLE_BUBBLES: {
-      glPushMatrix(); {
-        glScalef(2, 2, 1);
-        draw_purple_bubble(0, -90, 50, 6, clock);
-        draw_purple_bubble(-40, -25, 40, 5, clock);
-        draw_purple_bubble(30, -40, 35, 4, clock);
-        draw_purple_bubble(-55, -120, 32, 3, clock);
-        draw_purple_bubble(40, -130, 30, 2, clock);
-        draw_purple_bubble(63, -75, 27, 3, clock + 5);
-      } glPopMatrix();
-    } break;
+    case AZ_BG_PURPLE_BUBBLES: break;
     case AZ_BG_GREEN_DIAMONDS: {
       draw_green_diamond_quarter(0, 0, 60, 60, 10, 10);
       draw_green_diamond_quarter(0, 0, -60, 60, -10, 10);
@@ -820,17 +1015,7 @@ static void draw_bg_patch(az_background_pattern_t pattern, az_clock_t clock) {
       // Mid-bottom trunk branches:
       draw_tree_branch(   0, -350,  -20, -320, -90, -320,  -45, -370);
     } break;
-    case AZ_BG_BLUE_BUBBLES: {
-      glPushMatrix(); {
-        glScalef(1.5, 2, 1);
-        draw_blue_bubble(0, -90, 50, 6, clock);
-        draw_blue_bubble(-40, -25, 40, 5, clock);
-        draw_blue_bubble(30, -40, 35, 4, clock);
-        draw_blue_bubble(-55, -120, 32, 3, clock);
-        draw_blue_bubble(40, -130, 30, 2, clock);
-        draw_blue_bubble(63, -75, 27, 3, clock + 5);
-      } glPopMatrix();
-    } break;
+    case AZ_BG_BLUE_BUBBLES: break;
     case AZ_BG_GREEN_PANELLING: {
       const az_color_t color1 = {30, 60, 45, 255};
       const az_color_t color2 = {10, 30, 20, 255};
@@ -847,7 +1032,6 @@ static void draw_bg_patch(az_background_pattern_t pattern, az_clock_t clock) {
     case AZ_BG_TRIANGLE_STRUTS: {
       const az_color_t color1 = {20, 30, 40, 255};
       const az_color_t color2 = {10, 15, 20, 255};
-      const int phase = az_clock_mod(4, 20, clock);
       glBegin(GL_TRIANGLE_STRIP); {
         az_gl_color(color1); glVertex2f(-75,    0);
         az_gl_color(color2); glVertex2f(-63,   -7);
@@ -900,86 +1084,50 @@ static void draw_bg_patch(az_background_pattern_t pattern, az_clock_t clock) {
         az_gl_color(color1); glVertex2f( 75, -260);
         az_gl_color(color2); glVertex2f( 75, -246);
       } glEnd();
+    } break;
+    case AZ_BG_STARRY_NIGHT: break;
+  }
+}
 
-      draw_blinkenlight(-55.5,   -4, phase == 0);
-      draw_blinkenlight(-55.5, -256, phase == 0);
-      draw_blinkenlight(-18.5,   -4, phase == 1);
-      draw_blinkenlight(-18.5, -256, phase == 1);
-      draw_blinkenlight( 18.5,   -4, phase == 2);
-      draw_blinkenlight( 18.5, -256, phase == 2);
-      draw_blinkenlight( 55.5,   -4, phase == 3);
-      draw_blinkenlight( 55.5, -256, phase == 3);
-      draw_blinkenlight( 18.5, -126, phase == 0);
-      draw_blinkenlight( 18.5, -134, phase == 0);
-      draw_blinkenlight( 55.5, -126, phase == 1);
-      draw_blinkenlight( 55.5, -134, phase == 1);
-      draw_blinkenlight(-55.5, -126, phase == 2);
-      draw_blinkenlight(-55.5, -134, phase == 2);
-      draw_blinkenlight(-18.5, -126, phase == 3);
-      draw_blinkenlight(-18.5, -134, phase == 3);
-
-      draw_blinkenlight(-62.3,  -14.0, phase == 3);
-      draw_blinkenlight(-69.2,  -18.0, phase == 3);
-      draw_blinkenlight(-43.8,  -46.1, phase == 2);
-      draw_blinkenlight(-50.7,  -50.1, phase == 2);
-      draw_blinkenlight(-25.3,  -78.1, phase == 1);
-      draw_blinkenlight(-32.2,  -82.1, phase == 1);
-      draw_blinkenlight( -6.8, -110.2, phase == 0);
-      draw_blinkenlight(-13.7, -114.2, phase == 0);
-      draw_blinkenlight( 11.7, -142.2, phase == 3);
-      draw_blinkenlight(  4.8, -146.2, phase == 3);
-      draw_blinkenlight( 30.2, -174.2, phase == 2);
-      draw_blinkenlight( 23.3, -178.2, phase == 2);
-      draw_blinkenlight( 48.7, -206.3, phase == 1);
-      draw_blinkenlight( 41.8, -210.3, phase == 1);
-      draw_blinkenlight( 67.2, -238.3, phase == 0);
-      draw_blinkenlight( 60.3, -242.3, phase == 0);
+static void draw_bg_patch(az_background_pattern_t pattern, az_clock_t clock) {
+  const GLuint display_list =
+    bg_display_lists_start + PATTERN_LISTS_INDEX + (GLuint)pattern;
+  assert(glIsList(display_list));
+  draw_bg_patch_underlay(pattern, clock);
+  glCallList(display_list);
+  draw_bg_patch_overlay(pattern, clock);
+}
 
-      draw_blinkenlight( 62.3,  -14.0, phase == 0);
-      draw_blinkenlight( 69.2,  -18.0, phase == 0);
-      draw_blinkenlight( 43.8,  -46.1, phase == 1);
-      draw_blinkenlight( 50.7,  -50.1, phase == 1);
-      draw_blinkenlight( 25.3,  -78.1, phase == 2);
-      draw_blinkenlight( 32.2,  -82.1, phase == 2);
-      draw_blinkenlight(  6.8, -110.2, phase == 3);
-      draw_blinkenlight( 13.7, -114.2, phase == 3);
-      draw_blinkenlight(-11.7, -142.2, phase == 0);
-      draw_blinkenlight( -4.8, -146.2, phase == 0);
-      draw_blinkenlight(-30.2, -174.2, phase == 1);
-      draw_blinkenlight(-23.3, -178.2, phase == 1);
-      draw_blinkenlight(-48.7, -206.3, phase == 2);
-      draw_blinkenlight(-41.8, -210.3, phase == 2);
-      draw_blinkenlight(-67.2, -238.3, phase == 3);
-      draw_blinkenlight(-60.3, -242.3, phase == 3);
-    } break;
-    case AZ_BG_STARRY_NIGHT: {
-      const int star_spacing = 50;
-      const int semi_width = 0.5 * background_datas[pattern].repeat_horz;
-      const int bottom = -background_datas[pattern].repeat_vert;
-      az_random_seed_t seed = {1, 1};
-      int clock_offset = 0;
-      for (int xoff = -semi_width; xoff < semi_width; xoff += star_spacing) {
-        for (int yoff = 0; yoff > bottom; yoff -= star_spacing) {
-          const double twinkle =
-            0.5 + 0.05 * az_clock_zigzag(10, 4, clock + clock_offset);
-          const double size = 2 + 4 * az_rand_udouble(&seed);
-          const double cx = xoff + star_spacing * az_rand_udouble(&seed);
-          const double cy = yoff + star_spacing * az_rand_udouble(&seed);
-          glBegin(GL_TRIANGLE_FAN); {
-            glColor3f(0.5, 0.5, 0.5);
-            glVertex2d(cx, cy);
-            glColor3f(0.1, 0.1, 0.1);
-            for (int i = 0; i <= 360; i += 45) {
-              const double rho = size * (i % 2 == 0 ? twinkle : 0.3);
-              glVertex2d(cx + rho * cos(AZ_DEG2RAD(i)),
-                         cy + rho * sin(AZ_DEG2RAD(i)));
-            }
-          } glEnd();
-          clock_offset += 17;
-        }
-      }
-    } break;
+void az_init_background_drawing(void) {
+  bg_display_lists_start = glGenLists(NUM_BG_DISPLAY_LISTS);
+  if (bg_display_lists_start == 0u) {
+    AZ_FATAL("glGenLists failed.\n");
+  }
+  for (int i = 0; i < AZ_NUM_BG_PATTERNS; ++i) {
+    glNewList(bg_display_lists_start + PATTERN_LISTS_INDEX + i, GL_COMPILE); {
+      draw_static_bg_patch((az_background_pattern_t)i);
+    } glEndList();
+  }
+  compile_bubbles(GREEN_BUBBLE, (az_color_t){51, 51, 0, 255},
+                  (az_color_t){0, 51, 0, 255}, (az_color_t){0, 25, 51, 0});
+  compile_bubbles(PURPLE_BUBBLE, (az_color_t){40, 25, 51, 255},
+                  (az_color_t){25, 0, 51, 255}, (az_color_t){0, 0, 51, 0});
+  compile_bubbles(BROWN_BUBBLE, (az_color_t){40, 30, 10, 255},
+                  (az_color_t){40, 15, 0, 255}, (az_color_t){40, 0, 0, 0});
+  compile_bubbles(BLUE_BUBBLE, (az_color_t){25, 40, 51, 255},
+                  (az_color_t){0, 25, 51, 255}, (az_color_t){0, 0, 51, 0});
+  for (int lit = 0; lit < NUM_BLINKENLIGHT_LISTS; ++lit) {
+    glNewList(bg_display_lists_start + BLINKENLIGHT_LISTS_INDEX + lit,
+              GL_COMPILE); {
+      compile_blinkenlight(lit != 0);
+    } glEndList();
+  }
+  for (int step = 0; step < NUM_TWINKLE_STEPS; ++step) {
+    glNewList(bg_display_lists_start + STAR_LISTS_INDEX + step, GL_COMPILE); {
+      compile_star(step);
+    } glEndList();
   }
+  init_starry_night_stars();
 }
 
 void az_draw_background_pattern(
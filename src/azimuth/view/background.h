@@ -28,6 +28,11 @@
 
 /*===========================================================================*/
 
+// Call this at program startup to initialize drawing of background patterns.
+// This must be called _after_ az_init_gui, and must be called _before_ any
+// calls to az_draw_background_pattern.
+void az_init_background_drawing(void);
+
 void az_draw_background_pattern(
     az_background_pattern_t pattern, const az_camera_bounds_t *camera_bounds,
     az_vector_t camera_center, az_clock_t clock);
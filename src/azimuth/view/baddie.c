@@ -52,6 +52,54 @@
 
 /*===========================================================================*/
 
+static GLuint baddie_mesh_lists_start;
+static bool baddie_mesh_compiled[AZ_NUM_BADDIE_KINDS + 1]
+                                [AZ_MAX_BADDIE_MESHES_PER_KIND];
+static int baddie_mesh_depth = 0;
+static bool compiling_baddie_mesh = false;
+
+void az_init_baddie_drawing(void) {
+  baddie_mesh_lists_start =
+    glGenLists((AZ_NUM_BADDIE_KINDS + 1) * AZ_MAX_BADDIE_MESHES_PER_KIND);
+  if (baddie_mesh_lists_start == 0u) {
+    AZ_FATAL("glGenLists failed.\n");
+  }
+  // Any previously compiled meshes belonged to the old GL context, so they
+  // will be recompiled the next time they're drawn.
+  AZ_ZERO_ARRAY(baddie_mesh_compiled);
+}
+
+bool az_begin_baddie_mesh(const az_baddie_t *baddie, float frozen, int slot) {
+  assert(baddie->kind != AZ_BAD_NOTHING);
+  assert((int)baddie->kind <= AZ_NUM_BADDIE_KINDS);
+  assert(slot >= 0 && slot < AZ_MAX_BADDIE_MESHES_PER_KIND);
+  ++baddie_mesh_depth;
+  if (baddie_mesh_depth > 1 || baddie_mesh_lists_start == 0u ||
+      baddie->armor_flare != 0.0 || frozen != 0.0f) return true;
+  const GLuint display_list = baddie_mesh_lists_start +
+    baddie->kind * AZ_MAX_BADDIE_MESHES_PER_KIND + slot;
+  if (baddie_mesh_compiled[baddie->kind][slot]) {
+    assert(glIsList(display_list));
+    glCallList(display_list);
+    return false;
+  }
+  glNewList(display_list, GL_COMPILE_AND_EXECUTE);
+  baddie_mesh_compiled[baddie->kind][slot] = true;
+  compiling_baddie_mesh = true;
+  return true;
+}
+
+void az_end_baddie_mesh(void) {
+  assert(baddie_mesh_depth > 0);
+  --baddie_mesh_depth;
+  if (baddie_mesh_depth == 0 && compiling_baddie_mesh) {
+    glEndList();
+    compiling_baddie_mesh = false;
+  }
+}
+
+/*===========================================================================*/
+
 #if 0
 static void draw_component_outline(const az_component_data_t *component) {
   const az_polygon_t poly = component->polygon;
@@ -66,7 +114,7 @@ static void draw_component_outline(const az_component_data_t *component) {
       const double radius = component->bounding_radius;
       glVertex2f(0, 0);
       for (int i = 0; i <= 360; i += 10) {
-        glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius, i);
       }
     } glEnd();
   }
@@ -152,23 +200,43 @@ static void draw_eruption_bubble(double max_radius, int frames,
     glColor4f(0.5, 0.235, 0.15, 0.85 - 0.3 * mod);
     const double radius = max_radius * mod;
     for (int i = -90; i < 90; i += 10) {
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
     }
     for (int i = 90; i <= 270; i += 10) {
-      glVertex2d(0.25 * radius * cos(AZ_DEG2RAD(i)),
-                 radius * sin(AZ_DEG2RAD(i)));
+      glVertex2d(0.25 * radius * az_cos_deg(i),
+                 radius * az_sin_deg(i));
     }
   } glEnd();
 }
 
 /*===========================================================================*/
 
+// Return true if the given kind of baddie looks the same every frame (apart
+// from flaring and freezing), and depends on nothing but its kind.
+static bool is_static_kind(az_baddie_kind_t kind) {
+  switch (kind) {
+    case AZ_BAD_MARKER:
+    case AZ_BAD_BEAM_WALL:
+    case AZ_BAD_FORCE_EGG:
+    case AZ_BAD_ICE_CRYSTAL:
+    case AZ_BAD_SCRAP_METAL:
+      return true;
+    default: return false;
+  }
+}
+
 static void draw_baddie_internal(const az_baddie_t *baddie, az_clock_t clock) {
   const float flare = baddie->armor_flare;
   const float frozen = (baddie->frozen <= 0.0 ? 0.0 :
                         baddie->frozen >= 0.2 ? 0.5 + 0.5 * baddie->frozen :
                         az_clock_mod(3, 2, clock) < 2 ? 0.6 : 0.0);
   if (baddie->frozen > 0.0) clock = 0;
+  // Baddies that never animate are cached whole:
+  const bool whole_mesh = is_static_kind(baddie->kind);
+  if (whole_mesh && !az_begin_baddie_mesh(baddie, frozen, 0)) {
+    az_end_baddie_mesh();
+    return;
+  }
   switch (baddie->kind) {
     case AZ_BAD_NOTHING: AZ_ASSERT_UNREACHABLE();
     case AZ_BAD_MARKER:
@@ -314,16 +382,16 @@ static void draw_baddie_internal(const az_baddie_t *baddie, az_clock_t clock) {
         glColor3f(0.65 + 0.3 * flare - 0.3 * frozen, 0.65 - 0.3 * flare,
                   0.5 - 0.3 * flare + 0.5 * frozen);
         for (int i = 0; i <= 360; i += 60) {
-          glVertex2d(8 * cos(AZ_DEG2RAD(i)), 8 * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(8, i);
         }
       } glEnd();
       glBegin(GL_QUAD_STRIP); {
         for (int i = 0; i <= 360; i += 60) {
           glColor3f(0.65 + 0.3 * flare - 0.3 * frozen, 0.65 - 0.3 * flare,
                     0.5 - 0.3 * flare + 0.5 * frozen);
-          glVertex2d(8 * cos(AZ_DEG2RAD(i)), 8 * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(8, i);
           glColor3f(0.35f + 0.3f * flare, 0.35f, 0.15f + 0.3f * frozen);
-          glVertex2d(12 * cos(AZ_DEG2RAD(i)), 12 * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(12, i);
         }
       } glEnd();
       // Radiation symbol:
@@ -332,14 +400,14 @@ static void draw_baddie_internal(const az_baddie_t *baddie, az_clock_t clock) {
       glBegin(GL_TRIANGLE_FAN); {
         glVertex2d(0, 0);
         for (int i = 0; i <= 360; i += 30) {
-          glVertex2d(1.5 * cos(AZ_DEG2RAD(i)), 1.5 * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(1.5, i);
         }
       } glEnd();
       for (int j = 60; j < 420; j += 120) {
         glBegin(GL_QUAD_STRIP); {
           for (int i = j - 30; i <= j + 30; i += 10) {
-            glVertex2d(3 * cos(AZ_DEG2RAD(i)), 3 * sin(AZ_DEG2RAD(i)));
-            glVertex2d(8 * cos(AZ_DEG2RAD(i)), 8 * sin(AZ_DEG2RAD(i)));
+            az_gl_vertex_polar_deg(3, i);
+            az_gl_vertex_polar_deg(8, i);
           }
         } glEnd();
       }
@@ -433,8 +501,7 @@ static void draw_baddie_internal(const az_baddie_t *baddie, az_clock_t clock) {
           glVertex2d(-0.15 * radius, 0.2 * radius);
           glColor3f(0.2f + 0.3f * blink, 0.2f, 0.2f);
           for (int i = 0; i <= 360; i += 15) {
-            glVertex2d(radius * cos(AZ_DEG2RAD(i)),
-                       radius * sin(AZ_DEG2RAD(i)));
+            az_gl_vertex_polar_deg(radius, i);
           }
         } glEnd();
         const double hurt = (baddie->data->max_health - baddie->health) /
@@ -516,7 +583,7 @@ static void draw_baddie_internal(const az_baddie_t *baddie, az_clock_t clock) {
             glColor3f(0.5, 0.5, 0.5); glVertex2d(0, -1);
             glColor3f(0.2, 0.3, 0.3);
             for (int i = -105; i <= 105; i += 30) {
-              glVertex2d(5 * cos(AZ_DEG2RAD(i)), 7 * sin(AZ_DEG2RAD(i)) - 1);
+              glVertex2d(5 * az_cos_deg(i), 7 * az_sin_deg(i) - 1);
             }
           } glEnd();
           // Knee knob:
@@ -526,7 +593,7 @@ static void draw_baddie_internal(const az_baddie_t *baddie, az_clock_t clock) {
             glVertex2d(0, 0);
             glColor3f(0, 0.25, 0.1);
             for (int i = -135; i <= 135; i += 30) {
-              glVertex2d(6 * cos(AZ_DEG2RAD(i)), 5 * sin(AZ_DEG2RAD(i)));
+              glVertex2d(6 * az_cos_deg(i), 5 * az_sin_deg(i));
             }
           } glEnd();
           // Knee spike:
@@ -555,7 +622,7 @@ static void draw_baddie_internal(const az_baddie_t *baddie, az_clock_t clock) {
           glColor3f(0.5f * flare, 0.25, 0.1f + 0.9f * frozen);
           glVertex2d(-10, 0);
           for (int i = -135; i <= 135; i += 30) {
-            glVertex2d(12 * cos(AZ_DEG2RAD(i)), 9 * sin(AZ_DEG2RAD(i)));
+            glVertex2d(12 * az_cos_deg(i), 9 * az_sin_deg(i));
           }
           glVertex2d(-10, 0);
         } glEnd();
@@ -621,7 +688,7 @@ static void draw_baddie_internal(const az_baddie_t *baddie, az_clock_t clock) {
         glColor3f(0.35 + 0.3 * flare - 0.15 * frozen, 0.35 - 0.15 * flare,
                   0.35 - 0.15 * flare + 0.3 * frozen);
         for (int i = 0; i <= 360; i += 15) {
-          glVertex2d(7 * cos(AZ_DEG2RAD(i)), 7 * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(7, i);
         }
       } glEnd();
       // Light bulb:
@@ -632,7 +699,7 @@ static void draw_baddie_internal(const az_baddie_t *baddie, az_clock_t clock) {
         glVertex2f(0, 0);
         glColor3f(0, 0, 0);
         for (int i = 0; i <= 360; i += 20) {
-          glVertex2d(3 * cos(AZ_DEG2RAD(i)), 3 * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(3, i);
         }
       } glEnd();
       break;
@@ -769,6 +836,7 @@ static void draw_baddie_internal(const az_baddie_t *baddie, az_clock_t clock) {
       az_draw_bad_oth_tentacle(baddie, frozen, clock);
       break;
   }
+  if (whole_mesh) az_end_baddie_mesh();
 }
 
 void az_draw_baddie(const az_baddie_t *baddie, az_clock_t clock) {
@@ -21,12 +21,18 @@
 #ifndef AZIMUTH_VIEW_BADDIE_H_
 #define AZIMUTH_VIEW_BADDIE_H_
 
+#include <stdbool.h>
+
 #include "azimuth/state/baddie.h"
 #include "azimuth/state/space.h"
 #include "azimuth/util/clock.h"
 
 /*===========================================================================*/
 
+// Initialize the baddie mesh cache; this must be called (via
+// az_register_gl_init_func) before any baddies are drawn.
+void az_init_baddie_drawing(void);
+
 // Draw a single baddie.  The GL matrix should be at the camera position.
 void az_draw_baddie(const az_baddie_t *baddie, az_clock_t clock);
 
@@ -37,4 +43,23 @@ void az_draw_foreground_baddies(const az_space_state_t *state);
 
 /*===========================================================================*/
 
+// The number of separately-cached meshes each baddie kind may have:
+#define AZ_MAX_BADDIE_MESHES_PER_KIND 4
+
+// Parts of a baddie that don't animate can be compiled into a display list
+// the first time they are drawn, and replayed on later draws, so long as the
+// baddie is at rest (neither flaring nor frozen, since those change colors).
+// Use it like this:
+//   if (az_begin_baddie_mesh(baddie, frozen, 0)) {
+//     ...GL drawing commands...
+//   } az_end_baddie_mesh();
+// az_begin_baddie_mesh returns false if it has already drawn the cached mesh;
+// otherwise the drawing commands must be issued (and will be recorded if
+// possible).  The commands must depend only on the baddie's kind, its flare,
+// and the frozen value; nested meshes are simply drawn into the outer one.
+bool az_begin_baddie_mesh(const az_baddie_t *baddie, float frozen, int slot);
+void az_end_baddie_mesh(void);
+
+/*===========================================================================*/
+
 #endif // AZIMUTH_VIEW_BADDIE_H_
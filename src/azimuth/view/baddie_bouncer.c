@@ -44,7 +44,7 @@ void az_draw_bad_bouncer(
     glColor3f(0.25 + 0.02 * zig - 0.25 * frozen, 0.5 * flare,
               0.25 * frozen); // dark red
     for (int i = 0; i <= 360; i += 15) {
-      glVertex2d(15 * cos(AZ_DEG2RAD(i)), 15 * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(15, i);
     }
   } glEnd();
   glBegin(GL_TRIANGLE_FAN); {
@@ -67,7 +67,7 @@ void az_draw_bad_bouncer_90(
     glColor3f(0.5f * flare + 0.01f * zig, 0.25f + 0.25f * flare,
               0.25f + 0.25f * frozen);
     for (int i = 0; i <= 360; i += 15) {
-      glVertex2d(15 * cos(AZ_DEG2RAD(i)), 15 * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(15, i);
     }
   } glEnd();
   glBegin(GL_TRIANGLE_FAN); {
@@ -90,7 +90,7 @@ void az_draw_bad_fast_bouncer(
     glColor3f(0.25f + 0.02f * zig - 0.25f * frozen, 0.1f + 0.5f * flare,
               0.25f * frozen);
     for (int i = 0; i <= 360; i += 15) {
-      glVertex2d(15 * cos(AZ_DEG2RAD(i)), 15 * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(15, i);
     }
   } glEnd();
   glBegin(GL_TRIANGLE_FAN); {
@@ -114,8 +114,8 @@ static void draw_electron(double radius, az_vector_t position, double angle) {
       glVertex2d(-1, 1);
       glColor3f(cmult * 0.20, cmult * 0.15, cmult * 0.25); // dark purple-gray
       for (int i = 0; i <= 360; i += 15) {
-        glVertex2d(radius * rmult * cos(AZ_DEG2RAD(i)),
-                   radius * rmult * sin(AZ_DEG2RAD(i)));
+        glVertex2d(radius * rmult * az_cos_deg(i),
+                   radius * rmult * az_sin_deg(i));
       }
     } glEnd();
   } glPopMatrix();
@@ -135,7 +135,7 @@ static void draw_atom(const az_baddie_t *baddie, az_color_t inner,
     az_gl_color(outer);
     const double radius = baddie->data->main_body.bounding_radius;
     for (int i = 0; i <= 360; i += 15) {
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
     }
   } glEnd();
   for (int i = 0; i < baddie->data->num_components; ++i) {
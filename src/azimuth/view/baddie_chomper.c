@@ -113,15 +113,15 @@ void draw_pincers(const az_baddie_t *baddie, bool thorns,
           glBegin(GL_TRIANGLE_FAN); {
             const double sign = 3 - i * 2;
             glColor3f(0.75, 0.75, 0.75);
-            glVertex2d(9 + 14 * cos(AZ_DEG2RAD(j)),
-                       sign * (3 + 7 * sin(AZ_DEG2RAD(j))));
+            glVertex2d(9 + 14 * az_cos_deg(j),
+                       sign * (3 + 7 * az_sin_deg(j)));
             glColor3f(0.3, 0.3, 0.3);
-            glVertex2d(9 + 14 * cos(AZ_DEG2RAD(j - 10)),
-                       sign * (3 + 7 * sin(AZ_DEG2RAD(j - 10))));
-            glVertex2d(9 + 20 * cos(AZ_DEG2RAD(j)),
-                       sign * (3 + 14 * sin(AZ_DEG2RAD(j))));
-            glVertex2d(9 + 14 * cos(AZ_DEG2RAD(j + 10)),
-                       sign * (3 + 7 * sin(AZ_DEG2RAD(j + 10))));
+            glVertex2d(9 + 14 * az_cos_deg(j - 10),
+                       sign * (3 + 7 * az_sin_deg(j - 10)));
+            glVertex2d(9 + 20 * az_cos_deg(j),
+                       sign * (3 + 14 * az_sin_deg(j)));
+            glVertex2d(9 + 14 * az_cos_deg(j + 10),
+                       sign * (3 + 7 * az_sin_deg(j + 10)));
           } glEnd();
         }
       }
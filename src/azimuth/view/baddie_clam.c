@@ -43,7 +43,7 @@ void az_draw_bad_clam(
               0.25 * frozen + 0.5 * flare); // dark red
     const double radius = baddie->data->main_body.bounding_radius;
     for (int i = 0; i <= 360; i += 15) {
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
     }
   } glEnd();
   for (int i = 0; i < baddie->data->num_components; ++i) {
@@ -75,7 +75,7 @@ void az_draw_bad_clam(
     glVertex2f(-4, 0);
     for (int i = 135; i <= 225; i += 15) {
       if (i == 225) glColor4f(0.5, 0.4, 0.3, 0);
-      glVertex2d(15 * cos(AZ_DEG2RAD(i)), 13 * sin(AZ_DEG2RAD(i)));
+      glVertex2d(15 * az_cos_deg(i), 13 * az_sin_deg(i));
       if (i == 135) glColor3f(0.2, 0.15, 0.3);
     }
   } glEnd();
@@ -106,7 +106,7 @@ void az_draw_bad_grabber_plant(
     glBegin(GL_TRIANGLE_FAN); {
       az_gl_color(inner); glVertex2f(0, 0); az_gl_color(outer);
       for (int i = -135; i <= 135; i += 15) {
-        glVertex2d(6 * cos(AZ_DEG2RAD(i)), 4 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(6 * az_cos_deg(i), 4 * az_sin_deg(i));
       }
     } glEnd();
   } glPopMatrix();
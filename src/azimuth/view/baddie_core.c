@@ -60,7 +60,7 @@ static void draw_gear(const az_baddie_t *baddie, az_vector_t position,
     glBegin(GL_TRIANGLE_FAN); {
       az_gl_color(inner); glVertex2f(0, 0); az_gl_color(outer);
       for (int i = 0; i <= 360; i += 30) {
-        glVertex2d(9 * cos(AZ_DEG2RAD(i)), 9 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(9, i);
       }
     } glEnd();
     // Teeth:
@@ -79,10 +79,9 @@ static void draw_gear(const az_baddie_t *baddie, az_vector_t position,
     glBegin(GL_TRIANGLE_STRIP); {
       for (int i = 0; i <= 360; i += 20) {
         az_gl_color(outer);
-        glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius, i);
         az_gl_color(inner);
-        glVertex2d(inner_radius * cos(AZ_DEG2RAD(i)),
-                   inner_radius * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(inner_radius, i);
       }
     } glEnd();
   } glPopMatrix();
@@ -150,9 +149,9 @@ void az_draw_bad_zenith_core(const az_baddie_t *baddie, az_clock_t clock) {
   glBegin(GL_TRIANGLE_STRIP); {
     for (int i = 0; i <= 360; i += 90) {
       az_gl_color(outer);
-      glVertex2d(81 * cos(AZ_DEG2RAD(i)), 81 * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(81, i);
       az_gl_color(inner);
-      glVertex2d(89 * cos(AZ_DEG2RAD(i)), 89 * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(89, i);
     }
   } glEnd();
 
@@ -211,7 +210,7 @@ void az_draw_bad_zenith_core(const az_baddie_t *baddie, az_clock_t clock) {
   glBegin(GL_TRIANGLE_FAN); {
     az_gl_color(inner); glVertex2f(0, 0); az_gl_color(outer);
     for (int i = 0; i <= 360; i += 45) {
-      glVertex2d(16 * cos(AZ_DEG2RAD(i)), 16 * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(16, i);
     }
   } glEnd();
 
@@ -255,10 +254,10 @@ static void draw_band(double radius, az_color_t color, bool lit) {
       glBegin(GL_TRIANGLE_STRIP); {
         for (int i = 0; i <= 360; i += 45) {
           az_gl_color(inner);
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(radius, i);
           az_gl_color(outer);
-          glVertex2d((radius + thick) * cos(AZ_DEG2RAD(i)),
-                     (radius + thick) * sin(AZ_DEG2RAD(i)));
+          glVertex2d((radius + thick) * az_cos_deg(i),
+                     (radius + thick) * az_sin_deg(i));
         }
       } glEnd();
     }
@@ -266,7 +265,7 @@ static void draw_band(double radius, az_color_t color, bool lit) {
     glBegin(GL_LINE_LOOP); {
       glColor4f(0, 0, 0, 0.15);
       for (int i = 0; i < 360; i += 45) {
-        glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius, i);
       }
     } glEnd();
   }
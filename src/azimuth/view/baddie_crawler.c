@@ -89,8 +89,8 @@ void az_draw_bad_cave_crawler(
                  cos(AZ_DEG2RAD(i) * 777 *
                      (1 + az_clock_zigzag(7, 12, clock)))) +
           0.01 * az_clock_zigzag(10, 3, clock);
-        glVertex2d(15 * rr * cos(AZ_DEG2RAD(i)) - 3,
-                   17 * rr * sin(AZ_DEG2RAD(i)));
+        glVertex2d(15 * rr * az_cos_deg(i) - 3,
+                   17 * rr * az_sin_deg(i));
       }
     } glEnd();
   } glPopMatrix();
@@ -123,7 +123,7 @@ void az_draw_bad_spined_crawler(
                 0.12f + 0.5f * frozen);
       glVertex2f(-15, 0);
       for (int i = -120; i <= 120; i += 30) {
-        glVertex2d(13 * cos(AZ_DEG2RAD(i)) - 7, 16 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(13 * az_cos_deg(i) - 7, 16 * az_sin_deg(i));
       }
       glVertex2f(-15, 0);
     } glEnd();
@@ -155,7 +155,7 @@ void az_draw_bad_crab_crawler(
       az_gl_color(inner); glVertex2f(-13, 0); az_gl_color(outer);
       glVertex2f(-15, 0);
       for (int i = -120; i <= 120; i += 30) {
-        glVertex2d(11 * cos(AZ_DEG2RAD(i)) - 7, 16 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(11 * az_cos_deg(i) - 7, 16 * az_sin_deg(i));
       }
       glVertex2f(-15, 0);
     } glEnd();
@@ -194,7 +194,7 @@ void az_draw_bad_ice_crawler(
       glVertex2f(-15, 0);
       glColor3f(0.4f + 0.6f * flare, 0, 0.2);
       for (int i = -135; i <= 135; i += 5) {
-        glVertex2d(13 * cos(AZ_DEG2RAD(i)) - 4, 14 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(13 * az_cos_deg(i) - 4, 14 * az_sin_deg(i));
       }
     } glEnd();
     // Ice shell:
@@ -225,7 +225,7 @@ void az_draw_bad_fire_crawler(
       glVertex2f(-15, 0);
       glColor3f(0.4f + 0.6f * flare, 0, 0.2);
       for (int i = -135; i <= 135; i += 5) {
-        glVertex2d(9 * cos(AZ_DEG2RAD(i)) - 4, 12 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(9 * az_cos_deg(i) - 4, 12 * az_sin_deg(i));
       }
     } glEnd();
     // Flames:
@@ -239,8 +239,8 @@ void az_draw_bad_fire_crawler(
                   cos(AZ_DEG2RAD(i) * 777 *
                       (1 + 0.5 * az_clock_zigzag(14, 6, clock)))) +
           0.02 * az_clock_zigzag(10, 3, clock);
-        glVertex2d(14 * rr * cos(AZ_DEG2RAD(i)) - 3,
-                   (17 - fabs(i * 0.02)) * rr * sin(AZ_DEG2RAD(i)));
+        glVertex2d(14 * rr * az_cos_deg(i) - 3,
+                   (17 - fabs(i * 0.02)) * rr * az_sin_deg(i));
       }
     } glEnd();
     // Yellow glow:
@@ -250,8 +250,8 @@ void az_draw_bad_fire_crawler(
       glColor4f(1.0f, 0.9f, 0, 0);
       const double rr = 0.9 + 0.06 * az_clock_zigzag(6, 8, clock);
       for (int i = 0; i <= 360; i += 15) {
-        glVertex2d(11.0 * rr * cos(AZ_DEG2RAD(i)) - 3,
-                   14.0 * rr * sin(AZ_DEG2RAD(i)));
+        glVertex2d(11.0 * rr * az_cos_deg(i) - 3,
+                   14.0 * rr * az_sin_deg(i));
       }
     } glEnd();
   } glPopMatrix();
@@ -285,8 +285,8 @@ void az_draw_bad_jungle_crawler(
                   cos(AZ_DEG2RAD(i) * 777 *
                       (1 + az_clock_zigzag(7, 12, clock)))) +
           0.01 * az_clock_zigzag(10, 3, clock);
-        glVertex2d(13 * rr * cos(AZ_DEG2RAD(i)) - 3,
-                   16 * rr * sin(AZ_DEG2RAD(i)));
+        glVertex2d(13 * rr * az_cos_deg(i) - 3,
+                   16 * rr * az_sin_deg(i));
       }
     } glEnd();
   } glPopMatrix();
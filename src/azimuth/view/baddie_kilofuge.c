@@ -44,7 +44,7 @@ static void draw_eyeball(az_vector_t position, double angle, double radius,
       glColor3f(0.5f, (0.5f - 0.3f * hurt) * (1.0f - 0.8f * flare),
                   (0.5f - 0.4f * hurt) * (1.0f - 0.8f * flare));
       for (int j = 0; j <= 360; j += 20) {
-        glVertex2d(radius * cos(AZ_DEG2RAD(j)), radius * sin(AZ_DEG2RAD(j)));
+        az_gl_vertex_polar_deg(radius, j);
       }
     } glEnd();
     // Pupil:
@@ -52,8 +52,8 @@ static void draw_eyeball(az_vector_t position, double angle, double radius,
       glColor3f(0, 0, 0); glVertex2d(0.7 * radius, 0);
       glColor4f(0, 0, 0, 0.7f);
       for (int j = 0; j <= 360; j += 30) {
-        glVertex2d(0.2 * radius * cos(AZ_DEG2RAD(j)) + 0.7 * radius,
-                   0.3 * radius * sin(AZ_DEG2RAD(j)));
+        glVertex2d(0.2 * radius * az_cos_deg(j) + 0.7 * radius,
+                   0.3 * radius * az_sin_deg(j));
       }
     } glEnd();
   } glPopMatrix();
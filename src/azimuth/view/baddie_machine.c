@@ -42,15 +42,15 @@ static void draw_sensor_lamp(GLfloat x_offset, bool lit) {
       glVertex2f(0, 0);
       glColor3f(0.1, 0.1, 0.1);
       for (int i = 0; i <= 360; i += 20) {
-        glVertex2d(4 * cos(AZ_DEG2RAD(i)), 4 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(4, i);
       }
     } glEnd();
     glBegin(GL_QUAD_STRIP); {
       for (int i = 0; i <= 360; i += 20) {
         glColor3f(0.2, 0.2, 0.2);
-        glVertex2d(5 * cos(AZ_DEG2RAD(i)), 5 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(5, i);
         glColor3f(0.5, 0.5, 0.5);
-        glVertex2d(3 * cos(AZ_DEG2RAD(i)), 3 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(3, i);
       }
     } glEnd();
   } glPopMatrix();
@@ -76,7 +76,7 @@ static void draw_projectile_sensor(
                        15 * az_clock_mod(12, 1, clock) - 90);
     for (int i = -90; i <= 90; i += 15) {
       if (i == flash) az_gl_color(inner);
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
       if (i == flash) az_gl_color(outer);
     }
   } glEnd();
@@ -261,15 +261,15 @@ static void draw_ray(
       glVertex2f(0, 0);
       glColor3f(0.1, 0.1, 0.1);
       for (int i = 0; i <= 360; i += 20) {
-        glVertex2d(5 * cos(AZ_DEG2RAD(i)), 5 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(5, i);
       }
     } glEnd();
     glBegin(GL_QUAD_STRIP); {
       for (int i = 0; i <= 360; i += 20) {
         az_gl_color(dark);
-        glVertex2d(7 * cos(AZ_DEG2RAD(i)), 7 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(7, i);
         az_gl_color(medium);
-        glVertex2d(4 * cos(AZ_DEG2RAD(i)), 4 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(4, i);
       }
     } glEnd();
   } glPopMatrix();
@@ -309,7 +309,7 @@ static void draw_eye_and_eyelids(const az_baddie_t *baddie, float flare) {
     glColor3f(0.8f, 0.4f - 0.3f * flare, 0.1f);
     const double radius = baddie->data->components[0].bounding_radius;
     for (int i = 0; i <= 360; i += 10) {
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
     }
   } glEnd();
   glPushMatrix(); {
@@ -320,7 +320,7 @@ static void draw_eye_and_eyelids(const az_baddie_t *baddie, float flare) {
       glVertex2f(0, 0);
       glColor4f(baddie->param, 0, 0.25, 0.6);
       for (int i = 0; i <= 360; i += 10) {
-        glVertex2d(2.5 * cos(AZ_DEG2RAD(i)), 4 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(2.5 * az_cos_deg(i), 4 * az_sin_deg(i));
       }
     } glEnd();
   } glPopMatrix();
@@ -69,7 +69,7 @@ static void draw_magbeest_leg(const az_baddie_t *baddie, int leg_index) {
         glColor3f(0.3, 0.35, 0.35); glVertex2f(0, 0);
         glColor3f(0.2, 0.2, 0.2);
         for (int i = -90; i <= 90; i += 15) {
-          glVertex2d(-5 * cos(AZ_DEG2RAD(i)), 10 * sin(AZ_DEG2RAD(i)));
+          glVertex2d(-5 * az_cos_deg(i), 10 * az_sin_deg(i));
         }
       } glEnd();
     } else {
@@ -78,8 +78,8 @@ static void draw_magbeest_leg(const az_baddie_t *baddie, int leg_index) {
         glColor3f(0.3, 0.3, 0.3);
         glVertex2f(length - 10, 10); glVertex2f(length - 10, -10);
         for (int i = -90; i <= 90; i += 15) {
-          glVertex2d(10 * cos(AZ_DEG2RAD(i)) + length,
-                     10 * sin(AZ_DEG2RAD(i)));
+          glVertex2d(10 * az_cos_deg(i) + length,
+                     10 * az_sin_deg(i));
         }
       } glEnd();
       // Screw:
@@ -87,8 +87,8 @@ static void draw_magbeest_leg(const az_baddie_t *baddie, int leg_index) {
       glBegin(GL_TRIANGLE_FAN); {
         glColor3f(0.35, 0.4, 0.4);
         for (int i = 0; i < 360; i += 30) {
-          glVertex2d(5 * cos(AZ_DEG2RAD(i)) + length,
-                     5 * sin(AZ_DEG2RAD(i)));
+          glVertex2d(5 * az_cos_deg(i) + length,
+                     5 * az_sin_deg(i));
         }
       } glEnd();
       glBegin(GL_LINES); {
@@ -128,8 +128,8 @@ static void draw_magbeest_legs_base(const az_baddie_t *baddie) {
     glBegin(GL_TRIANGLE_FAN); {
       glColor3f(0.35, 0.4, 0.4);
       for (int i = 0; i < 360; i += 30) {
-        glVertex2d(5 * cos(AZ_DEG2RAD(i)) - 20,
-                   5 * sin(AZ_DEG2RAD(i)) + y);
+        glVertex2d(5 * az_cos_deg(i) - 20,
+                   5 * az_sin_deg(i) + y);
       }
     } glEnd();
     glBegin(GL_LINES); {
@@ -183,13 +183,13 @@ void az_draw_bad_magbeest_head(const az_baddie_t *baddie, az_clock_t clock) {
       glColor3f(0.25f + 0.75f * flare, 0.25f, 0.25f); glVertex2f(0, 0);
       glColor3f(0.07f + 0.3f * flare, 0.07f, 0.07f);
       for (int i = 0; i <= 360; i += 20) {
-        glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius, i);
       }
     } glEnd();
     glBegin(GL_TRIANGLE_FAN); {
       glColor3f(1, 0.3, 0); glVertex2f(15, 0); glColor4f(1, 0.3, 0, 0);
       for (int i = 0; i <= 360; i += 30) {
-        glVertex2d(15 + 4 * cos(AZ_DEG2RAD(i)), 6 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(15 + 4 * az_cos_deg(i), 6 * az_sin_deg(i));
       }
     } glEnd();
     const az_color_t cracks_color = {128, 64, 0, 64};
@@ -251,14 +251,14 @@ void az_draw_bad_magbeest_legs_l(const az_baddie_t *baddie, az_clock_t clock) {
       glColor3f(1, 1, 1); glVertex2f(0, 0);
       glColor3f(0.25, 0.25, 0.25);
       for (int i = 30; i <= 330; i += 30) {
-        glVertex2d(7 * cos(AZ_DEG2RAD(i)), 7 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(7, i);
       }
     } glEnd();
     // Screw:
     glBegin(GL_TRIANGLE_FAN); {
       glColor3f(0.35, 0.4, 0.4);
       for (int i = 0; i < 360; i += 30) {
-        glVertex2d(4 * cos(AZ_DEG2RAD(i)), 4 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(4, i);
       }
     } glEnd();
     // TODO: Make the screw stay fixed to the casing
@@ -270,9 +270,9 @@ void az_draw_bad_magbeest_legs_l(const az_baddie_t *baddie, az_clock_t clock) {
     glBegin(GL_TRIANGLE_STRIP); {
       for (int i = -35; i <= 35; i += 5) {
         glColor3f(0.25, 0.25, 0.25);
-        glVertex2d(55 - 30 * cos(AZ_DEG2RAD(i)), 30 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(55 - 30 * az_cos_deg(i), 30 * az_sin_deg(i));
         glColor3f(0.7, 0.7, 0.7);
-        glVertex2d(55 - 38 * cos(AZ_DEG2RAD(i)), 38 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(55 - 38 * az_cos_deg(i), 38 * az_sin_deg(i));
       }
     } glEnd();
   } glPopMatrix();
@@ -348,7 +348,7 @@ void az_draw_bad_magma_bomb(const az_baddie_t *baddie, az_clock_t clock) {
     glColor3f(0.35f + 0.6f * flare, 0.35f, 0.35f); glVertex2f(0, 0);
     glColor3f(0.1f + 0.4f * flare, 0.1f, 0.1f);
     for (int i = 0; i <= 360; i += 20) {
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
     }
   } glEnd();
   glBegin(GL_LINE_STRIP); {
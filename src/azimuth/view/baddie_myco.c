@@ -85,8 +85,8 @@ static void draw_shroom_spot(double cx, double cy, double w, double h) {
     glColor4f(0.1, 0.2, 0.3, 0.6); glVertex2f(cx, cy);
     glColor4f(0, 0, 0.3, 0);
     for (int i = 0; i <= 360; i += 30) {
-      const double y = cy + h * sin(AZ_DEG2RAD(i));
-      glVertex2d(cx + w * cos(AZ_DEG2RAD(i)) - 0.02 * cy * (y - cy), y);
+      const double y = cy + h * az_sin_deg(i);
+      glVertex2d(cx + w * az_cos_deg(i) - 0.02 * cy * (y - cy), y);
     }
   } glEnd();
 }
@@ -104,8 +104,8 @@ static void draw_shroom_cap(az_color_t inner, az_color_t outer,
       az_gl_color(outer);
       for (int i = 0; i <= 360; i += 15) {
         const double rho = 10.0 * (1.0 + cos(sin(1.5 * AZ_DEG2RAD(i))));
-        glVertex2d(2 + 0.5 * rho * cos(AZ_DEG2RAD(i)),
-                   rho * sin(AZ_DEG2RAD(i)));
+        glVertex2d(2 + 0.5 * rho * az_cos_deg(i),
+                   rho * az_sin_deg(i));
       }
     } glEnd();
     draw_shroom_spot(4, 10, 2.5, 5.5);
@@ -63,7 +63,7 @@ static void draw_nightbug_body(GLfloat green, double invis, float flare,
     glVertex2f(10, 0);
     glColor4f(0.5, 0.2, frozen, invis * invis); // reddish-brown
     for (int i = -90; i <= 90; i += 30) {
-      glVertex2d(10 + 7 * cos(AZ_DEG2RAD(i)), 5 * sin(AZ_DEG2RAD(i)));
+      glVertex2d(10 + 7 * az_cos_deg(i), 5 * az_sin_deg(i));
     }
   } glEnd();
   // Body:
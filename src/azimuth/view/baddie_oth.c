@@ -343,7 +343,7 @@ static void draw_tractor_beam(const az_baddie_t *baddie,
         glColor4f(redblue, 1, redblue, 0.5); glVertex2d(0, 0);
         glColor4f(redblue, 1, redblue, 0);
         for (int i = 90; i <= 270; i += 20) {
-          glVertex2d(thick * cos(AZ_DEG2RAD(i)), thick * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(thick, i);
         }
       } glEnd();
       glBegin(GL_TRIANGLE_STRIP); {
@@ -372,9 +372,9 @@ static void draw_gun_charge(const az_baddie_t *baddie, az_clock_t clock,
         glVertex2d(0, 0);
         glColor4f(1, 1, 1, 0.0);
         for (int i = 0; i <= 360; i += 60) {
-          const double degrees = (n == 0 ? i + offset : i - offset);
-          glVertex2d(radius * cos(AZ_DEG2RAD(degrees)),
-                     radius * sin(AZ_DEG2RAD(degrees)));
+          const int degrees = (n == 0 ? i + offset : i - offset);
+          glVertex2d(radius * az_cos_deg(degrees),
+                     radius * az_sin_deg(degrees));
         }
       } glEnd();
     }
@@ -62,7 +62,7 @@ static void draw_spiner(
       double radius = baddie->data->main_body.bounding_radius +
         0.2 * az_clock_zigzag(10, 3, clock) - 1.0;
       if (i % 45 == 0) radius -= 2.0;
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
     }
   } glEnd();
   for (int i = 0; i < 360; i += 45) {
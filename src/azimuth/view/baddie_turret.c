@@ -27,6 +27,7 @@
 #include "azimuth/state/baddie.h"
 #include "azimuth/util/clock.h"
 #include "azimuth/util/color.h"
+#include "azimuth/view/baddie.h"
 #include "azimuth/view/util.h"
 
 /*===========================================================================*/
@@ -63,56 +64,63 @@ static void draw_crawling_turret_legs(float flare, float frozen,
 }
 
 static void draw_turret_body_outer_edge(
-    const az_baddie_t *baddie, az_color_t far_edge, az_color_t mid_edge) {
-  glBegin(GL_QUAD_STRIP); {
-    for (int i = 0; i <= 360; i += 60) {
-      az_gl_color(mid_edge);
-      glVertex2d(18 * cos(AZ_DEG2RAD(i)), 18 * sin(AZ_DEG2RAD(i)));
-      az_gl_color(far_edge);
-      glVertex2d(20 * cos(AZ_DEG2RAD(i)), 20 * sin(AZ_DEG2RAD(i)));
-    }
-  } glEnd();
+    const az_baddie_t *baddie, float frozen, az_color_t far_edge,
+    az_color_t mid_edge) {
+  if (az_begin_baddie_mesh(baddie, frozen, 0)) {
+    glBegin(GL_QUAD_STRIP); {
+      for (int i = 0; i <= 360; i += 60) {
+        az_gl_color(mid_edge);
+        az_gl_vertex_polar_deg(18, i);
+        az_gl_color(far_edge);
+        az_gl_vertex_polar_deg(20, i);
+      }
+    } glEnd();
+  } az_end_baddie_mesh();
 }
 
 static void draw_turret_body_center(
-    const az_baddie_t *baddie, az_color_t mid_edge, az_color_t near_edge,
-    az_color_t center) {
-  az_gl_color(center);
-  glBegin(GL_POLYGON); {
-    for (int i = 0; i < 360; i += 60) {
-      glVertex2d(15 * cos(AZ_DEG2RAD(i)), 15 * sin(AZ_DEG2RAD(i)));
-    }
-  } glEnd();
-  glBegin(GL_QUAD_STRIP); {
-    for (int i = 0; i <= 360; i += 60) {
-      az_gl_color(near_edge);
-      glVertex2d(15 * cos(AZ_DEG2RAD(i)), 15 * sin(AZ_DEG2RAD(i)));
-      az_gl_color(mid_edge);
-      glVertex2d(18 * cos(AZ_DEG2RAD(i)), 18 * sin(AZ_DEG2RAD(i)));
-    }
-  } glEnd();
+    const az_baddie_t *baddie, float frozen, az_color_t mid_edge,
+    az_color_t near_edge, az_color_t center) {
+  if (az_begin_baddie_mesh(baddie, frozen, 1)) {
+    az_gl_color(center);
+    glBegin(GL_POLYGON); {
+      for (int i = 0; i < 360; i += 60) {
+        az_gl_vertex_polar_deg(15, i);
+      }
+    } glEnd();
+    glBegin(GL_QUAD_STRIP); {
+      for (int i = 0; i <= 360; i += 60) {
+        az_gl_color(near_edge);
+        az_gl_vertex_polar_deg(15, i);
+        az_gl_color(mid_edge);
+        az_gl_vertex_polar_deg(18, i);
+      }
+    } glEnd();
+  } az_end_baddie_mesh();
 }
 
-static void draw_turret(const az_baddie_t *baddie,
+static void draw_turret(const az_baddie_t *baddie, float frozen,
                         az_color_t far_edge, az_color_t mid_edge,
                         az_color_t near_edge, az_color_t center,
                         az_color_t gun_edge, az_color_t gun_middle) {
-  draw_turret_body_outer_edge(baddie, far_edge, mid_edge);
+  draw_turret_body_outer_edge(baddie, frozen, far_edge, mid_edge);
   glPushMatrix(); {
     glRotated(AZ_RAD2DEG(baddie->components[0].angle), 0, 0, 1);
-    glBegin(GL_QUAD_STRIP); {
-      az_gl_color(gun_edge);
-      glVertex2f( 0,  5); glVertex2f(30,  5);
-      az_gl_color(gun_middle);
-      glVertex2f( 0,  0); glVertex2f(30,  0);
-      az_gl_color(gun_edge);
-      glVertex2f( 0, -5); glVertex2f(30, -5);
-    } glEnd();
+    if (az_begin_baddie_mesh(baddie, frozen, 2)) {
+      glBegin(GL_QUAD_STRIP); {
+        az_gl_color(gun_edge);
+        glVertex2f( 0,  5); glVertex2f(30,  5);
+        az_gl_color(gun_middle);
+        glVertex2f( 0,  0); glVertex2f(30,  0);
+        az_gl_color(gun_edge);
+        glVertex2f( 0, -5); glVertex2f(30, -5);
+      } glEnd();
+    } az_end_baddie_mesh();
     const double hurt =
       (baddie->data->max_health - baddie->health) / baddie->data->max_health;
     az_draw_cracks((az_vector_t){30, 0}, AZ_PI, 2.0 * hurt);
   } glPopMatrix();
-  draw_turret_body_center(baddie, mid_edge, near_edge, center);
+  draw_turret_body_center(baddie, frozen, mid_edge, near_edge, center);
 }
 
 /*===========================================================================*/
@@ -120,7 +128,7 @@ static void draw_turret(const az_baddie_t *baddie,
 void az_draw_bad_normal_turret(
     const az_baddie_t *baddie, float frozen, az_clock_t clock) {
   const float flare = baddie->armor_flare;
-  draw_turret(baddie,
+  draw_turret(baddie, frozen,
               az_color3f(0.25 + 0.1 * flare - 0.1 * frozen,
                          0.25 - 0.1 * flare - 0.1 * frozen,
                          0.25 - 0.1 * flare + 0.1 * frozen),
@@ -142,7 +150,7 @@ void az_draw_bad_armored_turret(
     const az_baddie_t *baddie, float frozen, az_clock_t clock) {
   assert(baddie->kind == AZ_BAD_ARMORED_TURRET);
   const float flare = baddie->armor_flare;
-  draw_turret(baddie,
+  draw_turret(baddie, frozen,
               az_color3f(0.20 + 0.1 * flare - 0.1 * frozen,
                          0.20 - 0.1 * flare - 0.1 * frozen,
                          0.25 - 0.1 * flare + 0.1 * frozen),
@@ -164,7 +172,7 @@ void az_draw_bad_beam_turret(
     const az_baddie_t *baddie, float frozen, az_clock_t clock) {
   assert(baddie->kind == AZ_BAD_BEAM_TURRET);
   const float flare = baddie->armor_flare;
-  draw_turret(baddie,
+  draw_turret(baddie, frozen,
               az_color3f(0.20 + 0.1 * flare - 0.1 * frozen,
                          0.25 - 0.1 * flare - 0.1 * frozen,
                          0.20 - 0.1 * flare + 0.1 * frozen),
@@ -186,7 +194,7 @@ void az_draw_bad_broken_turret(
     const az_baddie_t *baddie, float frozen, az_clock_t clock) {
   assert(baddie->kind == AZ_BAD_BROKEN_TURRET);
   const float flare = baddie->armor_flare;
-  draw_turret(baddie,
+  draw_turret(baddie, frozen,
               az_color3f(0.30 + 0.1 * flare - 0.1 * frozen,
                          0.25 - 0.1 * flare - 0.1 * frozen,
                          0.20 - 0.1 * flare + 0.1 * frozen),
@@ -230,7 +238,7 @@ void az_draw_bad_heavy_turret(
     az_color3f(0.2 + 0.25 * flare, 0.2, 0.25 + 0.25 * frozen);
   const az_color_t gun_middle =
     az_color3f(0.6 + 0.25 * flare, 0.6, 0.75 + 0.25 * frozen);
-  draw_turret_body_outer_edge(baddie, far_edge, mid_edge);
+  draw_turret_body_outer_edge(baddie, frozen, far_edge, mid_edge);
   glPushMatrix(); {
     glRotated(AZ_RAD2DEG(baddie->components[0].angle), 0, 0, 1);
     for (int i = -1; i <= 1; i += 2) {
@@ -244,7 +252,7 @@ void az_draw_bad_heavy_turret(
       } glEnd();
     }
   } glPopMatrix();
-  draw_turret_body_center(baddie, mid_edge, near_edge, center);
+  draw_turret_body_center(baddie, frozen, mid_edge, near_edge, center);
   draw_normal_turret_cracks(baddie);
 }
 
@@ -252,7 +260,7 @@ void az_draw_bad_rocket_turret(
     const az_baddie_t *baddie, float frozen, az_clock_t clock) {
   assert(baddie->kind == AZ_BAD_ROCKET_TURRET);
   const float flare = baddie->armor_flare;
-  draw_turret(baddie,
+  draw_turret(baddie, frozen,
               az_color3f(0.20 + 0.1 * flare - 0.1 * frozen,
                          0.15 - 0.1 * flare - 0.1 * frozen,
                          0.15 - 0.1 * flare + 0.1 * frozen),
@@ -282,7 +290,7 @@ void az_draw_bad_crawling_mortar(
   assert(baddie->kind == AZ_BAD_CRAWLING_MORTAR);
   const float flare = baddie->armor_flare;
   draw_crawling_turret_legs(flare, frozen, clock);
-  draw_turret(baddie,
+  draw_turret(baddie, frozen,
               az_color3f(0.1 + 0.1 * flare - 0.1 * frozen, 0.1 - 0.05 * flare,
                          0.1 - 0.1 * flare + 0.1 * frozen),
               az_color3f(0.2 + 0.15 * flare - 0.15 * frozen, 0.2 - 0.1 * flare,
@@ -302,7 +310,7 @@ void az_draw_bad_security_drone(
   assert(baddie->kind == AZ_BAD_SECURITY_DRONE);
   const float flare = baddie->armor_flare;
   draw_turret_body_outer_edge(
-      baddie,
+      baddie, frozen,
       az_color3f(0.25 + 0.1 * flare - 0.1 * frozen,
                  0.25 - 0.1 * flare - 0.1 * frozen,
                  0.25 - 0.1 * flare + 0.1 * frozen),
@@ -336,7 +344,7 @@ void az_draw_bad_security_drone(
     } glEnd();
   } glPopMatrix();
   draw_turret_body_center(
-      baddie,
+      baddie, frozen,
       az_color3f(0.35 + 0.15 * flare - 0.15 * frozen,
                  0.35 - 0.15 * flare - 0.15 * frozen,
                  0.35 - 0.15 * flare + 0.15 * frozen),
@@ -364,7 +372,7 @@ void az_draw_bad_pop_open_turret(
     az_gl_color(outer);
     const double radius = baddie->data->main_body.bounding_radius;
     for (int i = 0; i <= 360; i += 10) {
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
     }
   } glEnd();
   // Barrel:
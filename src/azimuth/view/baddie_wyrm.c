@@ -65,7 +65,7 @@ static void draw_rockwyrm_segment(const az_baddie_t *baddie, int i) {
         } else {
           glColor3f(0.25, 0.35 - 0.3f * hurt, 0.125f);
         }
-        glVertex2d(radius * cos(AZ_DEG2RAD(j)), radius * sin(AZ_DEG2RAD(j)));
+        az_gl_vertex_polar_deg(radius, j);
       }
     } glEnd();
   } glPopMatrix();
@@ -84,7 +84,7 @@ void az_draw_bad_rockwyrm(const az_baddie_t *baddie) {
     glColor3f(0.5f, 0.25f - 0.25f * flare, 0.05);
     const double radius = baddie->data->main_body.bounding_radius;
     for (int i = 0; i <= 360; i += 30) {
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
     }
   } glEnd();
   // Jaws:
@@ -123,7 +123,7 @@ void az_draw_bad_wyrm_egg(
     glVertex2d(0.35 * radius, 0);
     glColor3f(0.3f, 0.4f - 0.2f * flare - 0.2f * frozen, 0.4f - 0.2f * flare);
     for (int i = 0; i <= 360; i += 15) {
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
     }
   } glEnd();
 }
@@ -137,7 +137,7 @@ void az_draw_bad_wyrmling(const az_baddie_t *baddie, float frozen) {
     glColor3f(0.5f, 0.25f - 0.25f * flare, 0.05);
     const double radius = baddie->data->main_body.bounding_radius;
     for (int i = 0; i <= 360; i += 30) {
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
     }
   } glEnd();
   // Neck/tail:
@@ -155,7 +155,7 @@ void az_draw_bad_wyrmling(const az_baddie_t *baddie, float frozen) {
         for (int j = 0; j <= 360; j += 30) {
           if (j % (last ? 360 : 180) == 0) glColor3f(0.5, 0.75, 0.15);
           else glColor3f(0.25, 0.35, 0.125);
-          glVertex2d(radius * cos(AZ_DEG2RAD(j)), radius * sin(AZ_DEG2RAD(j)));
+          az_gl_vertex_polar_deg(radius, j);
         }
       } glEnd();
     } glPopMatrix();
@@ -26,6 +26,7 @@
 #include "azimuth/state/baddie.h"
 #include "azimuth/util/clock.h"
 #include "azimuth/util/color.h"
+#include "azimuth/view/baddie.h"
 #include "azimuth/view/util.h"
 
 /*===========================================================================*/
@@ -38,19 +39,22 @@ static void draw_zipper_antennae(az_color_t color) {
 }
 
 static void draw_zipper_body(
-    az_color_t inner1, az_color_t inner2, az_color_t outer, double yscale) {
-  for (int i = -1; i <= 1; i += 2) {
-    glBegin(GL_QUAD_STRIP); {
-      for (int x = 20; x >= -15; x -= 5) {
-        const double y = i * yscale * (1 - pow(0.05 * x, 4) + 0.025 * x);
-        if (x % 2) az_gl_color(inner1);
-        else az_gl_color(inner2);
-        glVertex2d(x, 0);
-        az_gl_color(outer);
-        glVertex2d(x, y);
-      }
-    } glEnd();
-  }
+    const az_baddie_t *baddie, float frozen, az_color_t inner1,
+    az_color_t inner2, az_color_t outer, double yscale) {
+  if (az_begin_baddie_mesh(baddie, frozen, 0)) {
+    for (int i = -1; i <= 1; i += 2) {
+      glBegin(GL_QUAD_STRIP); {
+        for (int x = 20; x >= -15; x -= 5) {
+          const double y = i * yscale * (1 - pow(0.05 * x, 4) + 0.025 * x);
+          if (x % 2) az_gl_color(inner1);
+          else az_gl_color(inner2);
+          glVertex2d(x, 0);
+          az_gl_color(outer);
+          glVertex2d(x, y);
+        }
+      } glEnd();
+    }
+  } az_end_baddie_mesh();
 }
 
 static void draw_zipper_wings(
@@ -81,9 +85,9 @@ static void draw_zipper_wings(
 }
 
 static void draw_zipper(
-    az_color_t inner1, az_color_t inner2, az_color_t outer,
-    float flare, float frozen, az_clock_t clock) {
-  draw_zipper_body(inner1, inner2, outer, 6.0);
+    const az_baddie_t *baddie, az_color_t inner1, az_color_t inner2,
+    az_color_t outer, float flare, float frozen, az_clock_t clock) {
+  draw_zipper_body(baddie, frozen, inner1, inner2, outer, 6.0);
   draw_zipper_wings(10, 1.8, 3.8, flare, frozen, clock);
 }
 
@@ -92,7 +96,8 @@ static void draw_zipper(
 void az_draw_bad_zipper(
     const az_baddie_t *baddie, float frozen, az_clock_t clock) {
   const float flare = baddie->armor_flare;
-  draw_zipper(az_color3f(0.5 + 0.5 * flare - 0.5 * frozen, 1 - flare, frozen),
+  draw_zipper(baddie,
+              az_color3f(0.5 + 0.5 * flare - 0.5 * frozen, 1 - flare, frozen),
               az_color3f(0.4 - 0.4 * frozen, 0.4, frozen),
               az_color3f(0.4 * flare, 0.5, frozen), flare, frozen, clock);
 }
@@ -100,7 +105,8 @@ void az_draw_bad_zipper(
 void az_draw_bad_armored_zipper(
     const az_baddie_t *baddie, float frozen, az_clock_t clock) {
   const float flare = baddie->armor_flare;
-  draw_zipper(az_color3f(0.7f + 0.25f * flare - 0.5f * frozen,
+  draw_zipper(baddie,
+              az_color3f(0.7f + 0.25f * flare - 0.5f * frozen,
                          0.75f - 0.75f * flare,
                          0.7f + 0.3f * frozen),
               az_color3f(0, 0.4f, 0.4f + 0.6f * frozen),
@@ -119,7 +125,8 @@ void az_draw_bad_mini_armored_zipper(
 void az_draw_bad_fire_zipper(
     const az_baddie_t *baddie, float frozen, az_clock_t clock) {
   const float flare = baddie->armor_flare;
-  draw_zipper(az_color3f(0.5f + 0.5f * flare - 0.5f * frozen, 0.5f * frozen,
+  draw_zipper(baddie,
+              az_color3f(0.5f + 0.5f * flare - 0.5f * frozen, 0.5f * frozen,
                          1.0f - flare),
               az_color3f(0.6f - 0.6f * frozen, 0.4f, frozen),
               az_color3f(0.25f + 0.25f * flare, 0.25f * frozen,
@@ -133,7 +140,8 @@ void az_draw_bad_mosquito(
   glPushMatrix(); {
     glScalef(0.7, 0.7, 1);
     draw_zipper_antennae(az_color3f(0.5, 0.25, 0.25));
-    draw_zipper_body(az_color3f(1 - frozen, 0.5 - 0.5 * flare, frozen),
+    draw_zipper_body(baddie, frozen,
+                     az_color3f(1 - frozen, 0.5 - 0.5 * flare, frozen),
                      az_color3f(1 - frozen, 0.25, frozen),
                      az_color3f(0.4 + 0.4 * flare, 0, frozen), 8);
     draw_zipper_wings(5, -1.1, 1.9, flare, frozen, clock);
@@ -146,7 +154,8 @@ void az_draw_bad_gnat(
   glPushMatrix(); {
     glScalef(0.5, 0.5, 1);
     draw_zipper_antennae(az_color3f(0.5, 0.25, 0.25));
-    draw_zipper_body(az_color3f(0.5f + 0.5f * flare, 0.25f, 1.0f - flare),
+    draw_zipper_body(baddie, frozen,
+                     az_color3f(0.5f + 0.5f * flare, 0.25f, 1.0f - flare),
                      az_color3f(0.25f + 0.75f * flare, 0, 1.0f - flare),
                      az_color3f(0.4 + 0.4 * flare, 0, frozen), 8);
     draw_zipper_wings(5, -1.1, 1.9, flare, frozen, clock);
@@ -157,7 +166,8 @@ void az_draw_bad_dragonfly(
     const az_baddie_t *baddie, float frozen, az_clock_t clock) {
   const float flare = baddie->armor_flare;
   draw_zipper_antennae(az_color3f(0.5, 0.25, 0.25));
-  draw_zipper_body(az_color3f(1 - frozen, 0.5 - 0.5 * flare, frozen),
+  draw_zipper_body(baddie, frozen,
+                   az_color3f(1 - frozen, 0.5 - 0.5 * flare, frozen),
                    az_color3f(1 - frozen, 0.25, frozen),
                    az_color3f(0.4 + 0.4 * flare, 0, frozen), 4);
   draw_zipper_wings(5, -1.1, 1.9, flare, frozen, clock);
@@ -167,7 +177,8 @@ void az_draw_bad_hornet(
     const az_baddie_t *baddie, float frozen, az_clock_t clock) {
   const float flare = baddie->armor_flare;
   draw_zipper_antennae(az_color3f(0.5, 0.5, 0.25));
-  draw_zipper_body(az_color3f(1 - frozen, 1 - flare, frozen),
+  draw_zipper_body(baddie, frozen,
+                   az_color3f(1 - frozen, 1 - flare, frozen),
                    az_color3f(1 - frozen, 0.5, frozen),
                    az_color3f(0.4 + 0.4 * flare, 0.4, frozen), 4);
   draw_zipper_wings(5, -1.1, 1.9, flare, frozen, clock);
@@ -177,22 +188,25 @@ void az_draw_bad_super_hornet(
     const az_baddie_t *baddie, float frozen, az_clock_t clock) {
   const float flare = baddie->armor_flare;
   draw_zipper_antennae(az_color3f(0.25, 0.5, 0.12));
-  for (int y = -1; y <= 1; y += 2) {
-    for (int i = -3; i <= 4; ++i) {
-      glPushMatrix(); {
-        glScaled(1, y, 1);
-        const double x = 4 * i;
-        glTranslated(x, 4 * (1 - pow(0.05 * x, 4) + 0.025 * x), 0);
-        glBegin(GL_TRIANGLE_STRIP); {
-          glColor3f(0.1, 0.3, 0); glVertex2f(2, -2);
-          glColor3f(0.6, 0.9, 0.3); glVertex2f(i - 1, 2);
-          glColor3f(0.5, 0.8, 0); glVertex2f(0, -3);
-          glColor3f(0.1, 0.3, 0); glVertex2f(-2, -2);
-        } glEnd();
-      } glPopMatrix();
+  if (az_begin_baddie_mesh(baddie, frozen, 1)) {
+    for (int y = -1; y <= 1; y += 2) {
+      for (int i = -3; i <= 4; ++i) {
+        glPushMatrix(); {
+          glScaled(1, y, 1);
+          const double x = 4 * i;
+          glTranslated(x, 4 * (1 - pow(0.05 * x, 4) + 0.025 * x), 0);
+          glBegin(GL_TRIANGLE_STRIP); {
+            glColor3f(0.1, 0.3, 0); glVertex2f(2, -2);
+            glColor3f(0.6, 0.9, 0.3); glVertex2f(i - 1, 2);
+            glColor3f(0.5, 0.8, 0); glVertex2f(0, -3);
+            glColor3f(0.1, 0.3, 0); glVertex2f(-2, -2);
+          } glEnd();
+        } glPopMatrix();
+      }
     }
-  }
-  draw_zipper_body(az_color3f(0.6f - 0.6f * frozen, 0.5f - 0.5f * flare,
+  } az_end_baddie_mesh();
+  draw_zipper_body(baddie, frozen,
+                   az_color3f(0.6f - 0.6f * frozen, 0.5f - 0.5f * flare,
                               frozen),
                    az_color3f(0, 1.0f - 0.5f * frozen, frozen),
                    az_color3f(0.2 + 0.6 * flare, 0.4, frozen), 4);
@@ -206,7 +220,8 @@ void az_draw_bad_switcher(
     glTranslatef(-2.5, 0, 0);
     glScalef(0.75, 1, 1);
     draw_zipper_antennae(az_color3f(0.25, 0.75, 0.25));
-    draw_zipper_body(az_color3f(flare, 0.5 + 0.25 * frozen, 0.75),
+    draw_zipper_body(baddie, frozen,
+                     az_color3f(flare, 0.5 + 0.25 * frozen, 0.75),
                      az_color3f(0.5 - 0.5 * frozen, 1, 0.5 + 0.25 * frozen),
                      az_color3f(0.2 + 0.4 * flare, 0.1 + 0.4 * frozen,
                                 0.4 + 0.4 * frozen), 8);
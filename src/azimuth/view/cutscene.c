@@ -48,29 +48,94 @@ static az_color_t scale_color(float r, float g, float b, az_color_t color) {
 
 /*===========================================================================*/
 
-static void draw_moving_stars_layer(
-    double spacing, double scale, double speed, double total_time,
-    GLfloat gray) {
-  const double modulus = AZ_SCREEN_WIDTH + spacing;
-  const double scroll = fmod(total_time * speed, modulus);
-  az_random_seed_t seed = {1, 1};
-  glBegin(GL_LINES); {
+// The starfields never change apart from scrolling and twinkling, so we
+// generate the star positions just once, and then each frame we only need to
+// fill in the scroll offsets or twinkle colors and submit the vertex arrays.
+
+static void draw_line_arrays(int num_vertices, const GLfloat *vertices,
+                             const GLfloat *colors) {
+  glEnableClientState(GL_VERTEX_ARRAY);
+  glEnableClientState(GL_COLOR_ARRAY); {
+    glVertexPointer(2, GL_FLOAT, 0, vertices);
+    glColorPointer(3, GL_FLOAT, 0, colors);
+    glDrawArrays(GL_LINES, 0, num_vertices);
+  } glDisableClientState(GL_COLOR_ARRAY);
+  glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+#define NUM_MOVING_STAR_LAYERS 4
+#define MAX_STARS_PER_MOVING_LAYER 600
+
+static const struct {
+  double spacing;
+  double speed;
+  GLfloat gray;
+} moving_star_layer_specs[NUM_MOVING_STAR_LAYERS] = {
+  {30,  450, 0.15f}, {45,  600, 0.25f}, {80,  900, 0.40f}, {95, 1200, 0.50f}
+};
+
+static struct {
+  bool initialized;
+  struct {
+    int num_stars;
+    // Unscrolled star positions, with x already wrapped into [0, modulus):
+    double x[MAX_STARS_PER_MOVING_LAYER];
+    double y[MAX_STARS_PER_MOVING_LAYER];
+    // Each star is a line from a gray head to a black tail:
+    GLfloat colors[3 * 2 * MAX_STARS_PER_MOVING_LAYER];
+  } layers[NUM_MOVING_STAR_LAYERS];
+  GLfloat vertices[2 * 2 * MAX_STARS_PER_MOVING_LAYER];
+} moving_starfield;
+
+static void init_moving_starfield(void) {
+  for (int i = 0; i < NUM_MOVING_STAR_LAYERS; ++i) {
+    const double spacing = moving_star_layer_specs[i].spacing;
+    const GLfloat gray = moving_star_layer_specs[i].gray;
+    const double modulus = AZ_SCREEN_WIDTH + spacing;
+    az_random_seed_t seed = {1, 1};
+    int num_stars = 0;
     for (double xoff = 0.0; xoff < modulus; xoff += spacing) {
       for (double yoff = 0.0; yoff < modulus; yoff += spacing) {
-        const double x =
-          fmod(xoff + 3.0 * spacing * az_rand_udouble(&seed) + scroll,
-               modulus);
-        const double y = yoff + 3.0 * spacing * az_rand_udouble(&seed);
-        glColor3f(gray, gray, gray);
-        glVertex2d(x, y);
-        glColor3f(0, 0, 0);
-        glVertex2d(x - spacing * scale, y);
+        assert(num_stars < MAX_STARS_PER_MOVING_LAYER);
+        moving_starfield.layers[i].x[num_stars] =
+          fmod(xoff + 3.0 * spacing * az_rand_udouble(&seed), modulus);
+        moving_starfield.layers[i].y[num_stars] =
+          yoff + 3.0 * spacing * az_rand_udouble(&seed);
+        GLfloat *colors = &moving_starfield.layers[i].colors[6 * num_stars];
+        colors[0] = colors[1] = colors[2] = gray;
+        colors[3] = colors[4] = colors[5] = 0.0f;
+        ++num_stars;
       }
     }
-  } glEnd();
+    moving_starfield.layers[i].num_stars = num_stars;
+  }
+  moving_starfield.initialized = true;
+}
+
+static void draw_moving_stars_layer(int layer_index, double scale,
+                                    double total_time) {
+  assert(moving_starfield.initialized);
+  const double spacing = moving_star_layer_specs[layer_index].spacing;
+  const double modulus = AZ_SCREEN_WIDTH + spacing;
+  const double scroll =
+    fmod(total_time * moving_star_layer_specs[layer_index].speed, modulus);
+  const int num_stars = moving_starfield.layers[layer_index].num_stars;
+  const double *xs = moving_starfield.layers[layer_index].x;
+  const double *ys = moving_starfield.layers[layer_index].y;
+  GLfloat *vertices = moving_starfield.vertices;
+  for (int i = 0; i < num_stars; ++i) {
+    double x = xs[i] + scroll;
+    if (x >= modulus) x -= modulus;
+    vertices[4 * i] = x;
+    vertices[4 * i + 1] = vertices[4 * i + 3] = ys[i];
+    vertices[4 * i + 2] = x - spacing * scale;
+  }
+  draw_line_arrays(2 * num_stars, vertices,
+                   moving_starfield.layers[layer_index].colors);
 }
 
 void az_draw_moving_starfield(double time, double speed, double scale) {
+  if (!moving_starfield.initialized) init_moving_starfield();
   glPushMatrix(); {
     if (speed < 0) {
       glScalef(-1, 1, 1);
@@ -78,31 +143,67 @@ void az_draw_moving_starfield(double time, double speed, double scale) {
       speed = -speed;
     }
     time *= speed;
-    draw_moving_stars_layer(30, scale,  450, time, 0.15f);
-    draw_moving_stars_layer(45, scale,  600, time, 0.25f);
-    draw_moving_stars_layer(80, scale,  900, time, 0.40f);
-    draw_moving_stars_layer(95, scale, 1200, time, 0.50f);
+    for (int i = 0; i < NUM_MOVING_STAR_LAYERS; ++i) {
+      draw_moving_stars_layer(i, scale, time);
+    }
   } glPopMatrix();
 }
 
-static void draw_planet_starfield_internal(int width, az_clock_t clock) {
-  const int star_spacing = 12;
+#define PLANET_STAR_SPACING 12
+// The widest planet starfield we can draw (the civil war scene pans across a
+// starfield somewhat wider than the screen):
+#define MAX_PLANET_STARFIELD_WIDTH (AZ_SCREEN_WIDTH + 100)
+#define PLANET_STARFIELD_ROWS \
+  ((AZ_SCREEN_HEIGHT + PLANET_STAR_SPACING - 1) / PLANET_STAR_SPACING)
+#define MAX_PLANET_STARS (PLANET_STARFIELD_ROWS * \
+  ((MAX_PLANET_STARFIELD_WIDTH + PLANET_STAR_SPACING - 1) / \
+   PLANET_STAR_SPACING))
+
+static struct {
+  bool initialized;
+  // Stars are stored column by column, so that a narrower starfield is just a
+  // prefix of a wider one:
+  GLfloat vertices[2 * 2 * MAX_PLANET_STARS];
+  double base_gray[MAX_PLANET_STARS];
+  GLfloat colors[3 * 2 * MAX_PLANET_STARS];
+} planet_starfield;
+
+static void init_planet_starfield(void) {
   az_random_seed_t seed = {1, 1};
-  glBegin(GL_LINES); {
-    int i = 0;
-    for (int xoff = 0; xoff < width; xoff += star_spacing) {
-      for (int yoff = 0; yoff < AZ_SCREEN_HEIGHT; yoff += star_spacing) {
-        const int twinkle = az_clock_zigzag(10, 4, clock + i);
-        const GLfloat gray = (twinkle * 0.02) + 0.3 * az_rand_udouble(&seed);
-        glColor3f(gray, gray, gray);
-        const double x = xoff + 3 * star_spacing * az_rand_udouble(&seed);
-        const double y = yoff + 3 * star_spacing * az_rand_udouble(&seed);
-        glVertex2d(x, y);
-        glVertex2d(x + 1, y);
-        ++i;
-      }
+  int i = 0;
+  for (int xoff = 0; xoff < MAX_PLANET_STARFIELD_WIDTH;
+       xoff += PLANET_STAR_SPACING) {
+    for (int yoff = 0; yoff < AZ_SCREEN_HEIGHT; yoff += PLANET_STAR_SPACING) {
+      assert(i < MAX_PLANET_STARS);
+      planet_starfield.base_gray[i] = 0.3 * az_rand_udouble(&seed);
+      const double x =
+        xoff + 3 * PLANET_STAR_SPACING * az_rand_udouble(&seed);
+      const double y =
+        yoff + 3 * PLANET_STAR_SPACING * az_rand_udouble(&seed);
+      GLfloat *vertices = &planet_starfield.vertices[4 * i];
+      vertices[0] = x;
+      vertices[1] = vertices[3] = y;
+      vertices[2] = x + 1;
+      ++i;
     }
-  } glEnd();
+  }
+  assert(i == MAX_PLANET_STARS);
+  planet_starfield.initialized = true;
+}
+
+static void draw_planet_starfield_internal(int width, az_clock_t clock) {
+  assert(width <= MAX_PLANET_STARFIELD_WIDTH);
+  if (!planet_starfield.initialized) init_planet_starfield();
+  const int num_columns =
+    (width + PLANET_STAR_SPACING - 1) / PLANET_STAR_SPACING;
+  const int num_stars = num_columns * PLANET_STARFIELD_ROWS;
+  GLfloat *colors = planet_starfield.colors;
+  for (int i = 0; i < num_stars; ++i) {
+    const int twinkle = az_clock_zigzag(10, 4, clock + i);
+    const GLfloat gray = (twinkle * 0.02) + planet_starfield.base_gray[i];
+    for (int j = 0; j < 6; ++j) colors[6 * i + j] = gray;
+  }
+  draw_line_arrays(2 * num_stars, planet_starfield.vertices, colors);
 }
 
 void az_draw_planet_starfield(az_clock_t clock) {
@@ -154,8 +255,7 @@ static void draw_zenith_planet_internal(double blacken, double create,
                 glColor3f((az_clock_mod(6, 1, clk)     < 3 ? 1.0f : 0.25f),
                           (az_clock_mod(6, 1, clk + 2) < 3 ? 1.0f : 0.25f),
                           (az_clock_mod(6, 1, clk + 4) < 3 ? 1.0f : 0.25f));
-                glVertex2d(radius * cos(AZ_DEG2RAD(j * 120)),
-                           radius * sin(AZ_DEG2RAD(j * 120)));
+                az_gl_vertex_polar_deg(radius, j * 120);
               }
             } glEnd();
           } glPopMatrix();
@@ -207,8 +307,8 @@ static void draw_zenith_planet_internal(double blacken, double create,
         const double radius =
           blacken * (30 + 0.15 * az_clock_zigzag(90, 1, clock));
         for (int i = 0; i <= 360; i += 10) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)),
-                     radius * sin(AZ_DEG2RAD(i)) * 0.8);
+          glVertex2d(radius * az_cos_deg(i),
+                     radius * az_sin_deg(i) * 0.8);
         }
       } glEnd();
     }
@@ -285,8 +385,8 @@ static void draw_zenith_planet_internal(double blacken, double create,
         const double radius = 2 * (1 - deform - pow(1 - deform, 4)) *
           (60 + 0.15 * az_clock_zigzag(30, 1, clock));
         for (int i = 0; i <= 360; i += 10) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)),
-                     radius * sin(AZ_DEG2RAD(i)) * 0.8);
+          glVertex2d(radius * az_cos_deg(i),
+                     radius * az_sin_deg(i) * 0.8);
         }
       } glEnd();
     }
@@ -345,11 +445,9 @@ static void draw_sapiai_planet_atmosphere(
   glBegin(GL_TRIANGLE_STRIP); {
     for (int i = 0; i <= 360; i += 3) {
       az_gl_color(atmosphere_color);
-      glVertex2d(surface_radius * cos(AZ_DEG2RAD(i)),
-                 surface_radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(surface_radius, i);
       az_gl_color(outer_color);
-      glVertex2d(outer_radius * cos(AZ_DEG2RAD(i)),
-                 outer_radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(outer_radius, i);
     }
   } glEnd();
 }
@@ -367,11 +465,11 @@ static void draw_gas_planet_stripe(
           az_transition_color(min_color, max_color, transition);
         const float factor = (float)i / 90.0f;
         az_gl_color(scale_color(0.5f, 0.35f, 0.5f, base_color));
-        glVertex2d(sign * radius * cos(AZ_DEG2RAD(i)),
-                   -radius * sin(AZ_DEG2RAD(i)));
+        glVertex2d(sign * radius * az_cos_deg(i),
+                   -radius * az_sin_deg(i));
         az_gl_color(scale_color(1.0f - factor * 0.5f, 1.0f - factor * 0.65f,
                                 1.0f - factor * 0.5f, base_color));
-        glVertex2d(0, -radius * sin(AZ_DEG2RAD(i)));
+        glVertex2d(0, -radius * az_sin_deg(i));
       }
     } glEnd();
   }
@@ -577,8 +675,8 @@ static void draw_oth_scene(const az_cutscene_state_t *cutscene,
       const double radius =
         progress * (80 + 0.25 * az_clock_zigzag(90, 1, clock));
       for (int i = 0; i <= 360; i += 10) {
-        glVertex2d(radius * cos(AZ_DEG2RAD(i)),
-                   radius * sin(AZ_DEG2RAD(i)) * 0.8);
+        glVertex2d(radius * az_cos_deg(i),
+                   radius * az_sin_deg(i) * 0.8);
       }
     } glEnd();
   } glPopMatrix();
@@ -600,23 +698,23 @@ static void draw_sapiais_scene(
     glBegin(GL_TRIANGLE_FAN); {
       glColor3f(1, 1, 1); glVertex2d(0, 0);
       for (int i = 0; i <= 360; i += 3) {
-        glVertex2d(radius1 * cos(AZ_DEG2RAD(i)), radius1 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius1, i);
       }
     } glEnd();
     glBegin(GL_TRIANGLE_STRIP); {
       for (int i = 0; i <= 360; i += 3) {
         glColor3f(1, 1, 1);
-        glVertex2d(radius1 * cos(AZ_DEG2RAD(i)), radius1 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius1, i);
         glColor4f(1, 1, 1, 0.7);
-        glVertex2d(radius2 * cos(AZ_DEG2RAD(i)), radius2 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius2, i);
       }
     } glEnd();
     glBegin(GL_TRIANGLE_STRIP); {
       for (int i = 0; i <= 360; i += 3) {
         glColor4f(1, 1, 1, 0.7);
-        glVertex2d(radius2 * cos(AZ_DEG2RAD(i)), radius2 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius2, i);
         glColor4f(1, 1, 1, 0);
-        glVertex2d(radius3 * cos(AZ_DEG2RAD(i)), radius3 * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius3, i);
       }
     } glEnd();
   } glPopMatrix();
@@ -629,7 +727,7 @@ static void draw_sapiais_scene(
       glColor3f(0.5, 0.5, 0.55); glVertex2d(40, -40);
       glColor3f(0.3, 0.3, 0.35);
       for (int i = 0; i <= 360; i += 3) {
-        glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius, i);
       }
     } glEnd();
     draw_sapiai_planet_atmosphere(radius, 10 + 5 * glow,
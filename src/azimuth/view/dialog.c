@@ -60,8 +60,8 @@ static void draw_computer_circle(
   const double r2 = 5;
   glBegin(GL_QUAD_STRIP); {
     for (int i = 0; i <= 360; i += 30) {
-      const double c = cos(AZ_DEG2RAD(i));
-      const double s = sin(AZ_DEG2RAD(i));
+      const double c = az_cos_deg(i);
+      const double s = az_sin_deg(i);
       az_gl_color(color1);
       glVertex2d(cx + r1 * c, cy + r1 * s);
       az_gl_color(color2);
@@ -77,8 +77,8 @@ static void draw_computer_blinkenlight(
     az_gl_color(color);
     glVertex2d(cx, cy);
     for (int i = 0; i <= 360; i += 30) {
-      const double c = cos(AZ_DEG2RAD(i));
-      const double s = sin(AZ_DEG2RAD(i));
+      const double c = az_cos_deg(i);
+      const double s = az_sin_deg(i);
       glVertex2d(cx + r * c, cy + r * s);
     }
   } glEnd();
@@ -21,10 +21,13 @@
 
 #include <assert.h>
 #include <math.h>
+#include <stdbool.h>
 
 #include <GL/gl.h>
 
 #include "azimuth/state/node.h"
+#include "azimuth/util/misc.h"
+#include "azimuth/view/util.h"
 
 /*===========================================================================*/
 
@@ -68,15 +71,15 @@ static void draw_chain_link_pair(void) {
     glBegin(GL_TRIANGLE_STRIP); {
       for (int i = 90; i <= 270; i += 30) {
         glColor3f(0.25, 0.25, 0.25);
-        glVertex2d(3 + r1 * cos(AZ_DEG2RAD(i)), r1 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(3 + r1 * az_cos_deg(i), r1 * az_sin_deg(i));
         glColor3f(0.60, 0.60, 0.60);
-        glVertex2d(3 + r2 * cos(AZ_DEG2RAD(i)), r2 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(3 + r2 * az_cos_deg(i), r2 * az_sin_deg(i));
       }
       for (int i = -90; i <= 90; i += 30) {
         glColor3f(0.25, 0.25, 0.25);
-        glVertex2d(12 + r1 * cos(AZ_DEG2RAD(i)), r1 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(12 + r1 * az_cos_deg(i), r1 * az_sin_deg(i));
         glColor3f(0.60, 0.60, 0.60);
-        glVertex2d(12 + r2 * cos(AZ_DEG2RAD(i)), r2 * sin(AZ_DEG2RAD(i)));
+        glVertex2d(12 + r2 * az_cos_deg(i), r2 * az_sin_deg(i));
       }
       glColor3f(0.25, 0.25, 0.25); glVertex2d(3, r1);
       glColor3f(0.60, 0.60, 0.60); glVertex2d(3, r2);
@@ -100,7 +103,7 @@ static void draw_chain_link_pair(void) {
   } glEnd();
 }
 
-void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
+static void draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
   assert(0 <= (int)doodad_kind && (int)doodad_kind < AZ_NUM_DOODAD_KINDS);
   switch (doodad_kind) {
     case AZ_DOOD_WARNING_LIGHT:
@@ -111,7 +114,7 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
           glVertex2f(0, 0);
           glColor3f(0.25, 0.25, 0.25);
           for (int i = 0; i <= 360; i += 30) {
-            glVertex2d(4 * cos(AZ_DEG2RAD(i)), 4 * sin(AZ_DEG2RAD(i)));
+            az_gl_vertex_polar_deg(4, i);
           }
         } glEnd();
         for (int offset = 0; offset <= 180; offset += 180) {
@@ -119,7 +122,7 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
             glColor3f(1, 0, 0);
             glVertex2f(0, 0);
             for (int i = offset - 30; i <= offset + 30; i += 30) {
-              glVertex2d(3 * cos(AZ_DEG2RAD(i)), 3 * sin(AZ_DEG2RAD(i)));
+              az_gl_vertex_polar_deg(3, i);
             }
           } glEnd();
         }
@@ -155,10 +158,10 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
     case AZ_DOOD_PIPE_CORNER:
       for (int i = 180; i < 270; i += 15) {
         glBegin(GL_QUAD_STRIP); {
-          const double c1 = cos(AZ_DEG2RAD(i));
-          const double s1 = sin(AZ_DEG2RAD(i));
-          const double c2 = cos(AZ_DEG2RAD(i + 15));
-          const double s2 = sin(AZ_DEG2RAD(i + 15));
+          const double c1 = az_cos_deg(i);
+          const double s1 = az_sin_deg(i);
+          const double c2 = az_cos_deg(i + 15);
+          const double s2 = az_sin_deg(i + 15);
           glColor3f(0.1, 0.4, 0.1);
           glVertex2d(3 * c1, 3 * s1); glVertex2d(3 * c2, 3 * s2);
           glColor3f(0.65, 0.9, 0.65);
@@ -247,10 +250,10 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
     case AZ_DOOD_PIPE_ELBOW:
       for (int i = 180; i < 225; i += 15) {
         glBegin(GL_QUAD_STRIP); {
-          const double c1 = cos(AZ_DEG2RAD(i));
-          const double s1 = sin(AZ_DEG2RAD(i));
-          const double c2 = cos(AZ_DEG2RAD(i + 15));
-          const double s2 = sin(AZ_DEG2RAD(i + 15));
+          const double c1 = az_cos_deg(i);
+          const double s1 = az_sin_deg(i);
+          const double c2 = az_cos_deg(i + 15);
+          const double s2 = az_sin_deg(i + 15);
           glColor3f(0.1, 0.4, 0.1);
           glVertex2d(3 * c1, 3 * s1); glVertex2d(3 * c2, 3 * s2);
           glColor3f(0.65, 0.9, 0.65);
@@ -377,8 +380,8 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
     case AZ_DOOD_MACHINE_FAN:
       glBegin(GL_QUAD_STRIP); {
         for (int i = 45; i <= 405; i += 90) {
-          const double c = cos(AZ_DEG2RAD(i));
-          const double s = sin(AZ_DEG2RAD(i));
+          const double c = az_cos_deg(i);
+          const double s = az_sin_deg(i);
           glColor3f(0.25, 0.25, 0.25); glVertex2d(45.25 * c, 45.25 * s);
           glColor3f(0.15, 0.15, 0.15); glVertex2d(55 * c, 55 * s);
         }
@@ -391,7 +394,7 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
       glColor3f(0.15, 0.15, 0.15);
       glBegin(GL_POLYGON); {
         for (int i = 0; i < 360; i += 15) {
-          glVertex2d(28 * cos(AZ_DEG2RAD(i)), 28 * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(28, i);
         }
       } glEnd();
       glPushMatrix(); {
@@ -466,16 +469,16 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
               glVertex2f(0, 0);
               glColor3f(0, 0, 0);
               for (int k = 0; k <= 360; k += 20) {
-                glVertex2d(4 * cos(AZ_DEG2RAD(k)), 4 * sin(AZ_DEG2RAD(k)));
+                az_gl_vertex_polar_deg(4, k);
               }
             } glEnd();
             // Rim:
             glBegin(GL_QUAD_STRIP); {
               for (int k = 0; k <= 360; k += 20) {
                 glColor3f(0.45, 0.45, 0.45);
-                glVertex2d(4 * cos(AZ_DEG2RAD(k)), 4 * sin(AZ_DEG2RAD(k)));
+                az_gl_vertex_polar_deg(4, k);
                 glColor3f(0.35, 0.35, 0.35);
-                glVertex2d(6 * cos(AZ_DEG2RAD(k)), 6 * sin(AZ_DEG2RAD(k)));
+                az_gl_vertex_polar_deg(6, k);
               }
             } glEnd();
           } glPopMatrix();
@@ -485,21 +488,21 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
       glBegin(GL_TRIANGLE_FAN); {
         glColor3f(0.3, 0.3, 0.3); glVertex2f(0, 0); glColor3f(0, 0, 0);
         for (int k = 0; k <= 360; k += 90) {
-          glVertex2d(7 * cos(AZ_DEG2RAD(k)), 7 * sin(AZ_DEG2RAD(k)));
+          az_gl_vertex_polar_deg(7, k);
         }
       } glEnd();
       glBegin(GL_TRIANGLES); {
         const int k = -90 * az_clock_mod(8, 14, clock);
         glColor3f(0.7, 0.7, 0); glVertex2d(0, 0); glColor3f(0.4, 0.4, 0);
-        glVertex2d(6 * cos(AZ_DEG2RAD(k)), 6 * sin(AZ_DEG2RAD(k)));
-        glVertex2d(6 * cos(AZ_DEG2RAD(k + 90)), 6 * sin(AZ_DEG2RAD(k + 90)));
+        az_gl_vertex_polar_deg(6, k);
+        az_gl_vertex_polar_deg(6, k + 90);
       } glEnd();
       glBegin(GL_QUAD_STRIP); {
         for (int k = 0; k <= 360; k += 90) {
           glColor3f(0.45, 0.45, 0.45);
-          glVertex2d(7 * cos(AZ_DEG2RAD(k)), 7 * sin(AZ_DEG2RAD(k)));
+          az_gl_vertex_polar_deg(7, k);
           glColor3f(0.35, 0.35, 0.35);
-          glVertex2d(10 * cos(AZ_DEG2RAD(k)), 10 * sin(AZ_DEG2RAD(k)));
+          az_gl_vertex_polar_deg(10, k);
         }
       } glEnd();
       break;
@@ -671,7 +674,7 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
         float y_1 = 30;
         for (int i = 1; i <= 4; ++i) {
           const float x_2 = x_1 + j * 2;
-          const float y_2 = 8 * cos(AZ_DEG2RAD(i * 20)) + 22;
+          const float y_2 = 8 * az_cos_deg(i * 20) + 22;
           glBegin(GL_TRIANGLE_STRIP); {
             glColor3f(0.25, 0.25, 0.25);
             glVertex2f(x_1, y_1); glVertex2f(x_2, y_2);
@@ -704,21 +707,21 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
       glColor4f(1, 1, 0, 0.3);
       glBegin(GL_TRIANGLE_FAN); {
         for (int i = 30; i < 360; i += 60) {
-          glVertex2d(16 * cos(AZ_DEG2RAD(i)), 15.5 * sin(AZ_DEG2RAD(i)));
+          glVertex2d(16 * az_cos_deg(i), 15.5 * az_sin_deg(i));
         }
       } glEnd();
       glColor4f(0, 0, 0, 0.65);
       glBegin(GL_TRIANGLE_FAN); {
         glVertex2d(0, 0);
         for (int i = 0; i <= 360; i += 30) {
-          glVertex2d(2.5 * cos(AZ_DEG2RAD(i)), 2.5 * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(2.5, i);
         }
       } glEnd();
       for (int j = 60; j < 420; j += 120) {
         glBegin(GL_TRIANGLE_STRIP); {
           for (int i = j - 30; i <= j + 30; i += 10) {
-            glVertex2d(4.5 * cos(AZ_DEG2RAD(i)), 4.5 * sin(AZ_DEG2RAD(i)));
-            glVertex2d(11 * cos(AZ_DEG2RAD(i)), 10.5 * sin(AZ_DEG2RAD(i)));
+            az_gl_vertex_polar_deg(4.5, i);
+            glVertex2d(11 * az_cos_deg(i), 10.5 * az_sin_deg(i));
           }
         } glEnd();
       }
@@ -741,7 +744,7 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
       glBegin(GL_TRIANGLE_FAN); {
         glColor3f(0.3, 0.5, 0); glVertex2f(30, 0); glColor3f(0.1, 0.25, 0);
         for (int i = -90; i <= 90; i += 30) {
-          glVertex2d(30 + 5 * cos(AZ_DEG2RAD(i)), 3 * sin(AZ_DEG2RAD(i)));
+          glVertex2d(30 + 5 * az_cos_deg(i), 3 * az_sin_deg(i));
         }
       } glEnd();
       glPushMatrix(); {
@@ -865,3 +868,46 @@ void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
 }
 
 /*===========================================================================*/
+
+// Return true if the doodad's appearance changes with the clock, in which case
+// we have to draw it from scratch each frame rather than from a display list.
+static bool is_animated(az_doodad_kind_t doodad_kind) {
+  switch (doodad_kind) {
+    case AZ_DOOD_WARNING_LIGHT:
+    case AZ_DOOD_MACHINE_FAN:
+    case AZ_DOOD_NPS_ENGINE:
+    case AZ_DOOD_DRILL_SHAFT_SPIN:
+    case AZ_DOOD_HANGING_VINE:
+      return true;
+    default: return false;
+  }
+}
+
+static GLuint doodad_display_lists_start;
+
+void az_init_doodad_drawing(void) {
+  doodad_display_lists_start = glGenLists(AZ_NUM_DOODAD_KINDS);
+  if (doodad_display_lists_start == 0u) {
+    AZ_FATAL("glGenLists failed.\n");
+  }
+  for (int i = 0; i < AZ_NUM_DOODAD_KINDS; ++i) {
+    const az_doodad_kind_t doodad_kind = (az_doodad_kind_t)i;
+    if (is_animated(doodad_kind)) continue;
+    glNewList(doodad_display_lists_start + i, GL_COMPILE); {
+      draw_doodad(doodad_kind, 0);
+    } glEndList();
+  }
+}
+
+void az_draw_doodad(az_doodad_kind_t doodad_kind, az_clock_t clock) {
+  assert(0 <= (int)doodad_kind && (int)doodad_kind < AZ_NUM_DOODAD_KINDS);
+  if (is_animated(doodad_kind)) {
+    draw_doodad(doodad_kind, clock);
+  } else {
+    const GLuint display_list = doodad_display_lists_start + doodad_kind;
+    assert(glIsList(display_list));
+    glCallList(display_list);
+  }
+}
+
+/*===========================================================================*/
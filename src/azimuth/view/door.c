@@ -130,8 +130,8 @@ static void draw_door_pipe(GLfloat alpha, az_color_t light_color,
         glVertex2d(16, yc);
         az_gl_color(dim_color);
         for (int j = 0; j <= 360; j += 30) {
-          glVertex2d(16 + xr * cos(AZ_DEG2RAD(j)),
-                     yc + yr * sin(AZ_DEG2RAD(j)));
+          glVertex2d(16 + xr * az_cos_deg(j),
+                     yc + yr * az_sin_deg(j));
         }
       } glEnd();
     } else {
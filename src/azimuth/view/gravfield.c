@@ -21,10 +21,13 @@
 
 #include <assert.h>
 #include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
 
 #include <GL/gl.h>
 
 #include "azimuth/state/gravfield.h"
+#include "azimuth/state/room.h"
 #include "azimuth/state/space.h"
 #include "azimuth/util/misc.h"
 #include "azimuth/util/random.h"
@@ -77,21 +80,26 @@ static void draw_sector_pull_gravfield(const az_gravfield_t *gravfield) {
     az_signmod(0.5 * gravfield->age, stride, gravfield->strength);
   const double rlimit =
     (gravfield->strength < 0.0 ? outer_radius + stride : outer_radius);
+  // Every band uses the same angles, so compute their directions just once:
+  const int limit = ceil(interior_angle / AZ_DEG2RAD(6));
+  az_vector_t directions[62];
+  assert(limit < AZ_ARRAY_SIZE(directions));
+  const double step = interior_angle / limit;
+  for (int i = 0; i <= limit; ++i) {
+    directions[i] = az_vpolar(1.0, i * step);
+  }
   for (double r0 = inner_radius - offset; r0 < rlimit; r0 += stride) {
     const double r1 = r0 + copysign(stride, gravfield->strength);
     const double r0a = fmin(fmax(r0, inner_radius), outer_radius);
     const double r1a = fmin(fmax(r1, inner_radius), outer_radius);
     const GLfloat alpha0 = alpha_mult * fabs(r1 - r0a) / stride;
     const GLfloat alpha1 = alpha_mult * fabs(r1 - r1a) / stride;
-    const int limit = ceil(interior_angle / AZ_DEG2RAD(6));
-    const double step = interior_angle / limit;
     glBegin(GL_QUAD_STRIP); {
       for (int i = 0; i <= limit; ++i) {
-        const double t = i * step;
         glColor4f(0, 0.25, 0.5, alpha0); // dark bluish tint
-        glVertex2d(r0a * cos(t), r0a * sin(t));
+        az_gl_vertex(az_vmul(directions[i], r0a));
         glColor4f(0, 0, 0.5, alpha1); // dark blue tint
-        glVertex2d(r1a * cos(t), r1a * sin(t));
+        az_gl_vertex(az_vmul(directions[i], r1a));
       }
     } glEnd();
   }
@@ -143,20 +151,99 @@ static void draw_lava_bubble(double max_radius, double duration, double period,
     glColor4f(0.5, 0.3, 0.2, 0.5 - 0.3 * mod);
     const double radius = max_radius * mod;
     for (int i = -90; i < 90; i += 10) {
-      glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(radius, i);
     }
     for (int i = 90; i <= 270; i += 10) {
-      glVertex2d(0.25 * radius * cos(AZ_DEG2RAD(i)),
-                 radius * sin(AZ_DEG2RAD(i)));
+      glVertex2d(0.25 * radius * az_cos_deg(i),
+                 radius * az_sin_deg(i));
     }
   } glEnd();
 }
 
-static void draw_liquid_gravfield(
+// Liquid gravfields don't animate (apart from lava bubbles), and their shape
+// only changes if the gravfield is resized or moved, so we cache the geometry
+// for each gravfield slot and rebuild it only when it no longer matches the
+// gravfield (or the slot now holds a different gravfield).  The geometry is in
+// the gravfield's own frame, so turning the gravfield doesn't require a
+// rebuild.  A slot's mesh is freed once its gravfield goes away (e.g. when the
+// room is torn down).
+
+#define LIQUID_NUM_STEPS 20
+#define LIQUID_NUM_VERTICES (2 * (LIQUID_NUM_STEPS + 1))
+
+typedef struct {
+  double x, y, theta;
+  double radius, duration, period;
+  double timer_offset;
+} lava_bubble_t;
+
+typedef struct {
+  bool valid;
+  az_uid_t uid;
+  az_gravfield_kind_t kind;
+  az_gravfield_size_t size;
+  double position_norm;
+  GLfloat liquid_vertices[2 * LIQUID_NUM_VERTICES];
+  GLubyte liquid_colors[4 * LIQUID_NUM_VERTICES];
+  GLfloat mist_vertices[2 * LIQUID_NUM_VERTICES];
+  GLubyte mist_colors[4 * LIQUID_NUM_VERTICES];
+  int num_bubbles;
+  lava_bubble_t *bubbles; // owned; NULL if num_bubbles is zero
+} liquid_mesh_t;
+
+static liquid_mesh_t liquid_meshes[AZ_MAX_NUM_GRAVFIELDS];
+// Used for liquid gravfields that aren't in a space state (e.g. in the
+// editor), which have no slot or uid.  Each mesh is matched against the
+// gravfield's geometry, so several such gravfields can be drawn each frame
+// without evicting one another, as long as there aren't more of them than
+// this:
+#define NUM_SCRATCH_LIQUID_MESHES 8
+static liquid_mesh_t scratch_liquid_meshes[NUM_SCRATCH_LIQUID_MESHES];
+static int next_scratch_liquid_mesh = 0;
+
+static void set_color(GLubyte *out, az_color_t color) {
+  out[0] = color.r; out[1] = color.g; out[2] = color.b; out[3] = color.a;
+}
+
+static bool liquid_mesh_matches(const liquid_mesh_t *mesh,
+                                const az_gravfield_t *gravfield) {
+  return (mesh->valid && mesh->uid == gravfield->uid &&
+          mesh->kind == gravfield->kind &&
+          mesh->position_norm == az_vnorm(gravfield->position) &&
+          mesh->size.trapezoid.front_offset ==
+          gravfield->size.trapezoid.front_offset &&
+          mesh->size.trapezoid.front_semiwidth ==
+          gravfield->size.trapezoid.front_semiwidth &&
+          mesh->size.trapezoid.rear_semiwidth ==
+          gravfield->size.trapezoid.rear_semiwidth &&
+          mesh->size.trapezoid.semilength ==
+          gravfield->size.trapezoid.semilength);
+}
+
+static void free_liquid_mesh(liquid_mesh_t *mesh) {
+  free(mesh->bubbles);
+  mesh->bubbles = NULL;
+  mesh->num_bubbles = 0;
+  mesh->valid = false;
+}
+
+static liquid_mesh_t *scratch_liquid_mesh_for(
+    const az_gravfield_t *gravfield) {
+  if (!az_is_liquid(gravfield->kind)) return NULL;
+  AZ_ARRAY_LOOP(mesh, scratch_liquid_meshes) {
+    if (liquid_mesh_matches(mesh, gravfield)) return mesh;
+  }
+  liquid_mesh_t *mesh = &scratch_liquid_meshes[next_scratch_liquid_mesh];
+  next_scratch_liquid_mesh =
+    (next_scratch_liquid_mesh + 1) % NUM_SCRATCH_LIQUID_MESHES;
+  free_liquid_mesh(mesh);
+  return mesh;
+}
+
+static void build_liquid_mesh(
     const az_gravfield_t *gravfield, az_color_t deep_color,
-    az_color_t surface_color, az_color_t mist_color) {
+    az_color_t surface_color, az_color_t mist_color, liquid_mesh_t *mesh) {
   assert(az_is_liquid(gravfield->kind));
-  assert(gravfield->strength == 1.0);
   const double semilength = gravfield->size.trapezoid.semilength;
   const double front_offset = gravfield->size.trapezoid.front_offset;
   const double front_semiwidth = gravfield->size.trapezoid.front_semiwidth;
@@ -175,77 +262,113 @@ static void draw_liquid_gravfield(
     atan2(-rear_semiwidth, position_norm - semilength);
   const double inner_end_theta =
     atan2(rear_semiwidth, position_norm - semilength);
-  const int num_steps = 20;
   const double outer_step =
-    az_mod2pi_nonneg(outer_end_theta - outer_start_theta) / num_steps;
+    az_mod2pi_nonneg(outer_end_theta - outer_start_theta) / LIQUID_NUM_STEPS;
   const double inner_step =
-    az_mod2pi_nonneg(inner_end_theta - inner_start_theta) / num_steps;
-  // Draw the liquid itself:
-  glBegin(GL_QUAD_STRIP); {
-    for (int i = 0; i <= num_steps; ++i) {
-      const double inner_theta = inner_start_theta + i * inner_step;
-      const double outer_theta = outer_start_theta + i * outer_step;
-      az_gl_color(deep_color);
-      glVertex2d(inner_radius * cos(inner_theta) - position_norm,
-                 inner_radius * sin(inner_theta));
-      az_gl_color(surface_color);
-      glVertex2d(outer_radius * cos(outer_theta) - position_norm,
-                 outer_radius * sin(outer_theta));
-    }
-  } glEnd();
-  // Draw layer of mist above the liquid:
-  glBegin(GL_QUAD_STRIP); {
-    for (int i = 0; i <= num_steps; ++i) {
-      const double outer_theta = outer_start_theta + i * outer_step;
-      az_gl_color(surface_color);
-      glVertex2d(outer_radius * cos(outer_theta) - position_norm,
-                 outer_radius * sin(outer_theta));
-      az_gl_color(mist_color);
-      glVertex2d((outer_radius + 6) * cos(outer_theta) - position_norm,
-                 (outer_radius + 6) * sin(outer_theta));
-    }
-  } glEnd();
-  // For lava, draw bubbles:
+    az_mod2pi_nonneg(inner_end_theta - inner_start_theta) / LIQUID_NUM_STEPS;
+  mesh->valid = true;
+  mesh->uid = gravfield->uid;
+  mesh->kind = gravfield->kind;
+  mesh->size = gravfield->size;
+  mesh->position_norm = position_norm;
+  // The liquid itself, and the layer of mist above the liquid:
+  for (int i = 0; i <= LIQUID_NUM_STEPS; ++i) {
+    const double inner_theta = inner_start_theta + i * inner_step;
+    const double outer_theta = outer_start_theta + i * outer_step;
+    GLfloat *liquid = &mesh->liquid_vertices[4 * i];
+    liquid[0] = inner_radius * cos(inner_theta) - position_norm;
+    liquid[1] = inner_radius * sin(inner_theta);
+    liquid[2] = outer_radius * cos(outer_theta) - position_norm;
+    liquid[3] = outer_radius * sin(outer_theta);
+    set_color(&mesh->liquid_colors[8 * i], deep_color);
+    set_color(&mesh->liquid_colors[8 * i + 4], surface_color);
+    GLfloat *mist = &mesh->mist_vertices[4 * i];
+    mist[0] = liquid[2];
+    mist[1] = liquid[3];
+    mist[2] = (outer_radius + 6) * cos(outer_theta) - position_norm;
+    mist[3] = (outer_radius + 6) * sin(outer_theta);
+    set_color(&mesh->mist_colors[8 * i], surface_color);
+    set_color(&mesh->mist_colors[8 * i + 4], mist_color);
+  }
+  // For lava, place bubbles along the surface:
+  free(mesh->bubbles);
+  mesh->bubbles = NULL;
+  mesh->num_bubbles = 0;
   if (gravfield->kind == AZ_GRAV_LAVA) {
     const double bubble_spacing = 15.0;
     const double bubble_step = bubble_spacing / outer_radius;
-    double timer = gravfield->age;
+    int num_bubbles = 0;
+    for (double theta = outer_start_theta; theta < outer_end_theta;
+         theta += bubble_step) ++num_bubbles;
+    if (num_bubbles == 0) return;
+    mesh->bubbles = AZ_ALLOC(num_bubbles, lava_bubble_t);
+    double timer_offset = 0.0;
     az_random_seed_t seed = {1, 1};
     for (double theta = outer_start_theta; theta < outer_end_theta;
          theta += bubble_step) {
-      glPushMatrix(); {
-        glTranslated(outer_radius * cos(theta) - position_norm,
-                     outer_radius * sin(theta), 0);
-        az_gl_rotated(theta);
-        const double radius = 5.0 + az_rand_sdouble(&seed);
-        const double duration = 0.5 + 0.4 * az_rand_udouble(&seed);
-        const double period = duration + 0.6 + az_rand_udouble(&seed);
-        timer += 3.0 * az_rand_udouble(&seed);
-        draw_lava_bubble(radius, duration, period, timer);
-      } glPopMatrix();
+      assert(mesh->num_bubbles < num_bubbles);
+      lava_bubble_t *bubble = &mesh->bubbles[mesh->num_bubbles++];
+      bubble->x = outer_radius * cos(theta) - position_norm;
+      bubble->y = outer_radius * sin(theta);
+      bubble->theta = theta;
+      bubble->radius = 5.0 + az_rand_sdouble(&seed);
+      bubble->duration = 0.5 + 0.4 * az_rand_udouble(&seed);
+      bubble->period = bubble->duration + 0.6 + az_rand_udouble(&seed);
+      timer_offset += 3.0 * az_rand_udouble(&seed);
+      bubble->timer_offset = timer_offset;
     }
   }
 }
 
-static void draw_water_gravfield(const az_gravfield_t *gravfield) {
+static void draw_liquid_gravfield(
+    const az_gravfield_t *gravfield, liquid_mesh_t *mesh,
+    az_color_t deep_color, az_color_t surface_color, az_color_t mist_color) {
+  assert(az_is_liquid(gravfield->kind));
+  assert(gravfield->strength == 1.0);
+  if (!liquid_mesh_matches(mesh, gravfield)) {
+    build_liquid_mesh(gravfield, deep_color, surface_color, mist_color, mesh);
+  }
+  glEnableClientState(GL_VERTEX_ARRAY);
+  glEnableClientState(GL_COLOR_ARRAY); {
+    glVertexPointer(2, GL_FLOAT, 0, mesh->liquid_vertices);
+    glColorPointer(4, GL_UNSIGNED_BYTE, 0, mesh->liquid_colors);
+    glDrawArrays(GL_QUAD_STRIP, 0, LIQUID_NUM_VERTICES);
+    glVertexPointer(2, GL_FLOAT, 0, mesh->mist_vertices);
+    glColorPointer(4, GL_UNSIGNED_BYTE, 0, mesh->mist_colors);
+    glDrawArrays(GL_QUAD_STRIP, 0, LIQUID_NUM_VERTICES);
+  } glDisableClientState(GL_COLOR_ARRAY);
+  glDisableClientState(GL_VERTEX_ARRAY);
+  for (int i = 0; i < mesh->num_bubbles; ++i) {
+    const lava_bubble_t *bubble = &mesh->bubbles[i];
+    glPushMatrix(); {
+      glTranslated(bubble->x, bubble->y, 0);
+      az_gl_rotated(bubble->theta);
+      draw_lava_bubble(bubble->radius, bubble->duration, bubble->period,
+                       gravfield->age + bubble->timer_offset);
+    } glPopMatrix();
+  }
+}
+
+static void draw_water_gravfield(const az_gravfield_t *gravfield,
+                                 liquid_mesh_t *mesh) {
   assert(gravfield->kind == AZ_GRAV_WATER);
-  draw_liquid_gravfield(gravfield,
+  draw_liquid_gravfield(gravfield, mesh,
                         (az_color_t){26, 26, 102, 153},
                         (az_color_t){77, 153, 255, 77},
                         (az_color_t){255, 255, 255, 0});
 }
 
-static void draw_lava_gravfield(const az_gravfield_t *gravfield) {
+static void draw_lava_gravfield(const az_gravfield_t *gravfield,
+                                liquid_mesh_t *mesh) {
   assert(gravfield->kind == AZ_GRAV_LAVA);
-  draw_liquid_gravfield(gravfield,
+  draw_liquid_gravfield(gravfield, mesh,
                         (az_color_t){102, 26, 26, 200},
                         (az_color_t){255, 120, 77, 100},
                         (az_color_t){255, 200, 150, 0});
 }
 
-/*===========================================================================*/
-
-void az_draw_gravfield_no_transform(const az_gravfield_t *gravfield) {
+static void draw_gravfield_internal(const az_gravfield_t *gravfield,
+                                    liquid_mesh_t *mesh) {
   assert(gravfield->kind != AZ_GRAV_NOTHING);
   switch (gravfield->kind) {
     case AZ_GRAV_NOTHING: AZ_ASSERT_UNREACHABLE();
@@ -259,23 +382,34 @@ void az_draw_gravfield_no_transform(const az_gravfield_t *gravfield) {
       draw_sector_spin_gravfield(gravfield);
       break;
     case AZ_GRAV_WATER:
-      draw_water_gravfield(gravfield);
+      draw_water_gravfield(gravfield, mesh);
       break;
     case AZ_GRAV_LAVA:
-      draw_lava_gravfield(gravfield);
+      draw_lava_gravfield(gravfield, mesh);
       break;
   }
 }
 
-void az_draw_gravfield(const az_gravfield_t *gravfield) {
-  assert(gravfield->kind != AZ_GRAV_NOTHING);
+static void draw_gravfield_with_mesh(const az_gravfield_t *gravfield,
+                                     liquid_mesh_t *mesh) {
   glPushMatrix(); {
     az_gl_translated(gravfield->position);
     az_gl_rotated(gravfield->angle);
-    az_draw_gravfield_no_transform(gravfield);
+    draw_gravfield_internal(gravfield, mesh);
   } glPopMatrix();
 }
 
+/*===========================================================================*/
+
+void az_draw_gravfield_no_transform(const az_gravfield_t *gravfield) {
+  draw_gravfield_internal(gravfield, scratch_liquid_mesh_for(gravfield));
+}
+
+void az_draw_gravfield(const az_gravfield_t *gravfield) {
+  assert(gravfield->kind != AZ_GRAV_NOTHING);
+  draw_gravfield_with_mesh(gravfield, scratch_liquid_mesh_for(gravfield));
+}
+
 void az_draw_gravfields(const az_space_state_t *state) {
   AZ_ARRAY_LOOP(gravfield, state->gravfields) {
     if (gravfield->kind == AZ_GRAV_NOTHING) continue;
@@ -285,11 +419,19 @@ void az_draw_gravfields(const az_space_state_t *state) {
 }
 
 void az_draw_liquid(const az_space_state_t *state) {
-  AZ_ARRAY_LOOP(gravfield, state->gravfields) {
+  for (int i = 0; i < AZ_MAX_NUM_GRAVFIELDS; ++i) {
+    const az_gravfield_t *gravfield = &state->gravfields[i];
     if (az_is_liquid(gravfield->kind)) {
-      az_draw_gravfield(gravfield);
+      draw_gravfield_with_mesh(gravfield, &liquid_meshes[i]);
+    } else if (liquid_meshes[i].valid) {
+      free_liquid_mesh(&liquid_meshes[i]);
     }
   }
 }
 
+void az_free_liquid_meshes(void) {
+  AZ_ARRAY_LOOP(mesh, liquid_meshes) free_liquid_mesh(mesh);
+  AZ_ARRAY_LOOP(mesh, scratch_liquid_meshes) free_liquid_mesh(mesh);
+}
+
 /*===========================================================================*/
@@ -41,6 +41,10 @@ void az_draw_gravfields(const az_space_state_t *state);
 // position.
 void az_draw_liquid(const az_space_state_t *state);
 
+// Free the cached geometry for all liquid gravfields.  Call this when
+// leaving the space state whose gravfields were drawn.
+void az_free_liquid_meshes(void);
+
 /*===========================================================================*/
 
 #endif // AZIMUTH_VIEW_GRAVFIELD_H_
@@ -19,7 +19,11 @@
 
 #include "azimuth/view/minimap.h"
 
+#include <assert.h>
 #include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <GL/gl.h>
 
@@ -31,10 +35,47 @@
 
 /*===========================================================================*/
 
-void az_draw_minimap_room(
-    const az_planet_t *planet, const az_room_t *room, bool visited, bool blink,
-    az_vector_t camera_center) {
+// The most vertices that build_shape() can produce: the theta step is at least
+// 5% of the room's theta span, so each arc has at most 21 points (plus one for
+// rounding error), and each shape has two arcs plus four corners.
+#define MAX_SHAPE_VERTICES 48
+
+// The fill and outline vertices for one room's minimap shape.  These are
+// cached so that the HUD minimap doesn't have to redo all this trig for every
+// nearby room on every frame.  Each cached shape remembers the camera bounds
+// it was built from, so that if a room's bounds change (e.g. in the editor),
+// its shape just gets rebuilt the next time it's drawn.
+typedef struct {
+  const az_room_t *room; // NULL if this shape hasn't been built yet
+  az_camera_bounds_t bounds;
+  GLenum fill_mode;
+  int num_fill_vertices, num_outline_vertices;
+  GLfloat fill_vertices[2 * MAX_SHAPE_VERTICES];
+  GLfloat outline_vertices[2 * MAX_SHAPE_VERTICES];
+} az_minimap_shape_t;
+
+// Indexed by room key:
+static int num_minimap_shapes = 0;
+static az_minimap_shape_t *minimap_shapes = NULL;
+
+static void add_vertex(GLfloat *vertices, int *num_vertices,
+                       double x, double y) {
+  assert(*num_vertices < MAX_SHAPE_VERTICES);
+  vertices[2 * *num_vertices] = x;
+  vertices[2 * *num_vertices + 1] = y;
+  ++*num_vertices;
+}
+
+static void build_shape(const az_room_t *room, az_minimap_shape_t *shape) {
   const az_camera_bounds_t *bounds = &room->camera_bounds;
+  shape->room = room;
+  shape->bounds = *bounds;
+  shape->num_fill_vertices = shape->num_outline_vertices = 0;
+  GLfloat *fill = shape->fill_vertices;
+  int *num_fill = &shape->num_fill_vertices;
+  GLfloat *outline = shape->outline_vertices;
+  int *num_outline = &shape->num_outline_vertices;
+
   const double min_r = bounds->min_r - AZ_SCREEN_HEIGHT/2;
   const double max_r = min_r + bounds->r_span + AZ_SCREEN_HEIGHT;
   const double min_theta = bounds->min_theta;
@@ -45,33 +86,93 @@ void az_draw_minimap_room(
     az_vpolar(AZ_SCREEN_WIDTH/2, max_theta + AZ_HALF_PI);
   const double step = fmax(AZ_DEG2RAD(0.1), bounds->theta_span * 0.05);
 
+  if (bounds->theta_span >= 6.28) {
+    shape->fill_mode = GL_POLYGON;
+    for (double theta = 0.0; theta < AZ_TWO_PI; theta += step) {
+      const double x = max_r * cos(theta), y = max_r * sin(theta);
+      add_vertex(fill, num_fill, x, y);
+      add_vertex(outline, num_outline, x, y);
+    }
+  } else {
+    shape->fill_mode = GL_QUAD_STRIP;
+    add_vertex(fill, num_fill, min_r * cos(min_theta) + offset1.x,
+               min_r * sin(min_theta) + offset1.y);
+    add_vertex(fill, num_fill, max_r * cos(min_theta) + offset1.x,
+               max_r * sin(min_theta) + offset1.y);
+    add_vertex(outline, num_outline, min_r * cos(min_theta) + offset1.x,
+               min_r * sin(min_theta) + offset1.y);
+    add_vertex(outline, num_outline, max_r * cos(min_theta) + offset1.x,
+               max_r * sin(min_theta) + offset1.y);
+    for (double theta = min_theta; theta <= max_theta; theta += step) {
+      const double c = cos(theta), s = sin(theta);
+      add_vertex(fill, num_fill, min_r * c, min_r * s);
+      add_vertex(fill, num_fill, max_r * c, max_r * s);
+      add_vertex(outline, num_outline, max_r * c, max_r * s);
+    }
+    add_vertex(fill, num_fill, min_r * cos(max_theta) + offset2.x,
+               min_r * sin(max_theta) + offset2.y);
+    add_vertex(fill, num_fill, max_r * cos(max_theta) + offset2.x,
+               max_r * sin(max_theta) + offset2.y);
+    add_vertex(outline, num_outline, max_r * cos(max_theta) + offset2.x,
+               max_r * sin(max_theta) + offset2.y);
+    add_vertex(outline, num_outline, min_r * cos(max_theta) + offset2.x,
+               min_r * sin(max_theta) + offset2.y);
+    for (double theta = max_theta; theta >= min_theta; theta -= step) {
+      add_vertex(outline, num_outline, min_r * cos(theta),
+                 min_r * sin(theta));
+    }
+  }
+}
+
+static bool same_bounds(const az_camera_bounds_t *b1,
+                        const az_camera_bounds_t *b2) {
+  return (b1->min_r == b2->min_r && b1->r_span == b2->r_span &&
+          b1->min_theta == b2->min_theta && b1->theta_span == b2->theta_span);
+}
+
+static const az_minimap_shape_t *get_shape(const az_planet_t *planet,
+                                           const az_room_t *room) {
+  const int room_key = room - planet->rooms;
+  assert(0 <= room_key && room_key < planet->num_rooms);
+  if (room_key >= num_minimap_shapes) {
+    az_minimap_shape_t *new_shapes =
+      AZ_ALLOC(planet->num_rooms, az_minimap_shape_t);
+    if (minimap_shapes != NULL) {
+      memcpy(new_shapes, minimap_shapes,
+             num_minimap_shapes * sizeof(az_minimap_shape_t));
+      free(minimap_shapes);
+    }
+    minimap_shapes = new_shapes;
+    num_minimap_shapes = planet->num_rooms;
+  }
+  az_minimap_shape_t *shape = &minimap_shapes[room_key];
+  if (shape->room != room || !same_bounds(&shape->bounds,
+                                          &room->camera_bounds)) {
+    build_shape(room, shape);
+  }
+  return shape;
+}
+
+static void draw_vertex_array(GLenum mode, int num_vertices,
+                              const GLfloat *vertices) {
+  glEnableClientState(GL_VERTEX_ARRAY); {
+    glVertexPointer(2, GL_FLOAT, 0, vertices);
+    glDrawArrays(mode, 0, num_vertices);
+  } glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+void az_draw_minimap_room(
+    const az_planet_t *planet, const az_room_t *room, bool visited, bool blink,
+    az_vector_t camera_center) {
+  const az_minimap_shape_t *shape = get_shape(planet, room);
+
   // Fill room with color:
   const az_color_t zone_color = planet->zones[room->zone_key].color;
   if (!visited) {
     glColor3ub(zone_color.r / 4, zone_color.g / 4, zone_color.b / 4);
   } else glColor3ub(zone_color.r, zone_color.g, zone_color.b);
-  if (bounds->theta_span >= 6.28) {
-    glBegin(GL_POLYGON); {
-      for (double theta = 0.0; theta < AZ_TWO_PI; theta += step) {
-        glVertex2d(max_r * cos(theta), max_r * sin(theta));
-      }
-    } glEnd();
-  } else {
-    glBegin(GL_QUAD_STRIP); {
-      glVertex2d(min_r * cos(min_theta) + offset1.x,
-                 min_r * sin(min_theta) + offset1.y);
-      glVertex2d(max_r * cos(min_theta) + offset1.x,
-                 max_r * sin(min_theta) + offset1.y);
-      for (double theta = min_theta; theta <= max_theta; theta += step) {
-        glVertex2d(min_r * cos(theta), min_r * sin(theta));
-        glVertex2d(max_r * cos(theta), max_r * sin(theta));
-      }
-      glVertex2d(min_r * cos(max_theta) + offset2.x,
-                 min_r * sin(max_theta) + offset2.y);
-      glVertex2d(max_r * cos(max_theta) + offset2.x,
-                 max_r * sin(max_theta) + offset2.y);
-    } glEnd();
-  }
+  draw_vertex_array(shape->fill_mode, shape->num_fill_vertices,
+                    shape->fill_vertices);
 
   // Blink camera rect:
   if (blink) {
@@ -90,28 +191,8 @@ void az_draw_minimap_room(
 
   // Draw outline:
   glColor3f(0.9, 0.9, 0.9); // white
-  glBegin(GL_LINE_LOOP); {
-    if (bounds->theta_span >= 6.28) {
-      for (double theta = 0.0; theta < AZ_TWO_PI; theta += step) {
-        glVertex2d(max_r * cos(theta), max_r * sin(theta));
-      }
-    } else {
-      glVertex2d(min_r * cos(min_theta) + offset1.x,
-                 min_r * sin(min_theta) + offset1.y);
-      glVertex2d(max_r * cos(min_theta) + offset1.x,
-                 max_r * sin(min_theta) + offset1.y);
-      for (double theta = min_theta; theta <= max_theta; theta += step) {
-        glVertex2d(max_r * cos(theta), max_r * sin(theta));
-      }
-      glVertex2d(max_r * cos(max_theta) + offset2.x,
-                 max_r * sin(max_theta) + offset2.y);
-      glVertex2d(min_r * cos(max_theta) + offset2.x,
-                 min_r * sin(max_theta) + offset2.y);
-      for (double theta = max_theta; theta >= min_theta; theta -= step) {
-        glVertex2d(min_r * cos(theta), min_r * sin(theta));
-      }
-    } glEnd();
-  }
+  draw_vertex_array(GL_LINE_LOOP, shape->num_outline_vertices,
+                    shape->outline_vertices);
 }
 
 /*===========================================================================*/
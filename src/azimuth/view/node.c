@@ -56,7 +56,7 @@ static void draw_console(const az_node_t *node, az_clock_t clock) {
         glColor4f(1, 1, 1, 0);
         const double radius = 10 + az_clock_zigzag(6, 6, clock);
         for (int i = 0; i <= 360; i += 30) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(radius, i);
         }
       } glEnd();
       // Port:
@@ -282,7 +282,7 @@ static void draw_tractor_node(az_node_status_t status, az_clock_t clock) {
     glVertex2f(0, 0);
     glColor3f(0.35, 0.35, 0.35);
     for (int i = 0; i <= 360; i += 30) {
-      glVertex2d(6 * cos(AZ_DEG2RAD(i)), 6 * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(6, i);
     }
   } glEnd();
   glBegin(GL_TRIANGLE_FAN); {
@@ -298,7 +298,7 @@ static void draw_tractor_node(az_node_status_t status, az_clock_t clock) {
     glVertex2f(0, 0);
     glColor4f(0, 0, 0, 0);
     for (int i = 0; i <= 360; i += 30) {
-      glVertex2d(4 * cos(AZ_DEG2RAD(i)), 4 * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(4, i);
     }
   } glEnd();
 }
@@ -372,9 +372,9 @@ void az_draw_upgrade_icon(az_upgrade_t upgrade, az_clock_t clock) {
           for (int i = 0; i <= 360; i += 60) {
             const double radius = 13.0;
             const int offset = 15 * frame;
-            const double degrees = (n == 0 ? i + offset : i - offset);
-            glVertex2d(radius * cos(AZ_DEG2RAD(degrees)),
-                       radius * sin(AZ_DEG2RAD(degrees)));
+            const int degrees = (n == 0 ? i + offset : i - offset);
+            glVertex2d(radius * az_cos_deg(degrees),
+                       radius * az_sin_deg(degrees));
           }
         } glEnd();
       }
@@ -386,13 +386,13 @@ void az_draw_upgrade_icon(az_upgrade_t upgrade, az_clock_t clock) {
         const bool flash2 = frame / 2 != 0;
         glColor3f(0, (flash2 ? 0.5 : 1), 1);
         for (int i = 0; i < 3; ++i) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(120 * i + (flash1 ? 30 : 90))),
-                     radius * sin(AZ_DEG2RAD(120 * i + (flash1 ? 30 : 90))));
+          glVertex2d(radius * az_cos_deg(120 * i + (flash1 ? 30 : 90)),
+                     radius * az_sin_deg(120 * i + (flash1 ? 30 : 90)));
         }
         glColor3f(0, (flash2 ? 1 : 0.5), 1);
         for (int i = 0; i < 3; ++i) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(120 * i + (flash1 ? 90 : 30))),
-                     radius * sin(AZ_DEG2RAD(120 * i + (flash1 ? 90 : 30))));
+          glVertex2d(radius * az_cos_deg(120 * i + (flash1 ? 90 : 30)),
+                     radius * az_sin_deg(120 * i + (flash1 ? 90 : 30)));
         }
       } glEnd();
       break;
@@ -447,8 +447,8 @@ void az_draw_upgrade_icon(az_upgrade_t upgrade, az_clock_t clock) {
         glColor3f(1, 1, 0.5);
         const double radius = 10.0 + 4.5 * frame;
         for (int i = 15; i <= 75; i += 15) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)) - 12,
-                     radius * sin(AZ_DEG2RAD(i)) - 12);
+          glVertex2d(radius * az_cos_deg(i) - 12,
+                     radius * az_sin_deg(i) - 12);
         }
       } glEnd();
       break;
@@ -574,7 +574,7 @@ void az_draw_upgrade_icon(az_upgrade_t upgrade, az_clock_t clock) {
         const double radius = 6 + 0.95 * (frame == 3 ? 1 : frame);
         glColor4f(0, 0.5, 1, 0.5);
         for (int i = 0; i <= 360; i += 10) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(radius, i);
         }
       } glEnd();
       break;
@@ -626,8 +626,8 @@ void az_draw_upgrade_icon(az_upgrade_t upgrade, az_clock_t clock) {
           glColor4f(1, 1, 1, 0.7);
           const double radius = 2.5 * (frame + 1);
           for (int i = 0; i <= 360; i += 20) {
-            glVertex2d(radius * cos(AZ_DEG2RAD(i)),
-                       0.7 * radius * sin(AZ_DEG2RAD(i)));
+            glVertex2d(radius * az_cos_deg(i),
+                       0.7 * radius * az_sin_deg(i));
           }
         } glEnd();
       } glPopMatrix();
@@ -678,12 +678,12 @@ void az_draw_upgrade_icon(az_upgrade_t upgrade, az_clock_t clock) {
         glColor4f(1, 1, 1, 0.5);
         glBegin(GL_LINE_STRIP); {
           for (int i = 0; i <= 180; i += 20) {
-            glVertex2d(12 * cos(AZ_DEG2RAD(i)), spin1 * sin(AZ_DEG2RAD(i)));
+            glVertex2d(12 * az_cos_deg(i), spin1 * az_sin_deg(i));
           }
         } glEnd();
         glBegin(GL_LINE_STRIP); {
           for (int i = -90; i <= 90; i += 20) {
-            glVertex2d(spin2 * cos(AZ_DEG2RAD(i)), 12 * sin(AZ_DEG2RAD(i)));
+            glVertex2d(spin2 * az_cos_deg(i), 12 * az_sin_deg(i));
           }
         } glEnd();
         glBegin(GL_TRIANGLE_FAN); {
@@ -691,18 +691,18 @@ void az_draw_upgrade_icon(az_upgrade_t upgrade, az_clock_t clock) {
           glVertex2f(0, 0);
           glColor3f(0.3, 0.07, 0);
           for (int i = 0; i <= 360; i += 20) {
-            glVertex2d(5.5 * cos(AZ_DEG2RAD(i)), 5.5 * sin(AZ_DEG2RAD(i)));
+            az_gl_vertex_polar_deg(5.5, i);
           }
         } glEnd();
         glColor4f(1, 1, 1, 0.5);
         glBegin(GL_LINE_STRIP); {
           for (int i = 180; i <= 360; i += 20) {
-            glVertex2d(12 * cos(AZ_DEG2RAD(i)), spin1 * sin(AZ_DEG2RAD(i)));
+            glVertex2d(12 * az_cos_deg(i), spin1 * az_sin_deg(i));
           }
         } glEnd();
         glBegin(GL_LINE_STRIP); {
           for (int i = 90; i <= 270; i += 20) {
-            glVertex2d(spin2 * cos(AZ_DEG2RAD(i)), 12 * sin(AZ_DEG2RAD(i)));
+            glVertex2d(spin2 * az_cos_deg(i), 12 * az_sin_deg(i));
           }
         } glEnd();
       } glPopMatrix();
@@ -754,13 +754,13 @@ void az_draw_upgrade_icon(az_upgrade_t upgrade, az_clock_t clock) {
         glVertex2f(0, 0);
         glColor4f(0.5, 0, 1, 0.1);
         for (int i = 0; i <= 360; i += 60) {
-          glVertex2d(r * cos(AZ_DEG2RAD(i)), r * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(r, i);
         }
       } glEnd();
       glBegin(GL_LINE_LOOP); {
         glColor4f(0.5, 0, 1, 0.9);
         for (int i = 0; i < 360; i += 60) {
-          glVertex2d(r * cos(AZ_DEG2RAD(i)), r * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(r, i);
         }
       } glEnd();
     } break;
@@ -770,8 +770,8 @@ void az_draw_upgrade_icon(az_upgrade_t upgrade, az_clock_t clock) {
         const GLfloat r1 = 6.0f + 0.5f * (frame == 3 ? 1 : frame);
         const GLfloat r2 = r1 + 1.5f;
         for (int i = 0; i <= 360; i += 20) {
-          glVertex2d(r1 * cos(AZ_DEG2RAD(i)), r1 * sin(AZ_DEG2RAD(i)));
-          glVertex2d(r2 * cos(AZ_DEG2RAD(i)), r2 * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(r1, i);
+          az_gl_vertex_polar_deg(r2, i);
         }
       } glEnd();
       glBegin(GL_TRIANGLE_FAN); {
@@ -793,13 +793,13 @@ void az_draw_upgrade_icon(az_upgrade_t upgrade, az_clock_t clock) {
         glColor4f(1, 1, 0.5, 0.5); glVertex2f(0, 8);
         glColor4f(1, 1, 0.5, 0);
         for (int i = 0; i <= 360; i += 30) {
-          glVertex2d(8 * scale * cos(AZ_DEG2RAD(i)),
-                     5 * scale * sin(AZ_DEG2RAD(i)) + 8);
+          glVertex2d(8 * scale * az_cos_deg(i),
+                     5 * scale * az_sin_deg(i) + 8);
         }
       } glEnd();
       glBegin(GL_TRIANGLE_STRIP); {
         for (int i = -200; i <= 20; i += 20) {
-          const double c = cos(AZ_DEG2RAD(i)), s = sin(AZ_DEG2RAD(i));
+          const double c = az_cos_deg(i), s = az_sin_deg(i);
           glColor3f(1, 0, 0); glVertex2d(8 * c, 8 * s - 3);
           glColor3f(0.7, 0, 0); glVertex2d(4 * c, 4 * s - 3);
         }
@@ -821,7 +821,7 @@ void az_draw_upgrade_icon(az_upgrade_t upgrade, az_clock_t clock) {
         glColor4f(1, (frame < 2 ? 0.5f : 0.0f), 0, 0);
         const double radius = (frame < 2 ? 5 : 4);
         for (int i = 0; i <= 360; i += 30) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(radius, i);
         }
       } glEnd();
       glPushMatrix(); {
@@ -48,7 +48,7 @@ static void draw_bolt_glowball(az_color_t color, double cx, az_clock_t clock) {
     with_color_alpha(color, 0);
     const double rad = 8 + az_clock_zigzag(5, 8, clock);
     for (int i = 0; i <= 360; i += 30) {
-      glVertex2d(rad * cos(AZ_DEG2RAD(i)) + cx, rad * sin(AZ_DEG2RAD(i)));
+      glVertex2d(rad * az_cos_deg(i) + cx, rad * az_sin_deg(i));
     }
   } glEnd();
 }
@@ -93,8 +93,8 @@ void az_draw_particle(const az_particle_t *particle, az_clock_t clock) {
         with_color_alpha(particle->color, 0);
         for (int i = -90; i <= 90; i += 30) {
           glVertex2d(particle->param1 +
-                     particle->param2 * cos(AZ_DEG2RAD(i)) * 0.75,
-                     particle->param2 * sin(AZ_DEG2RAD(i)));
+                     particle->param2 * az_cos_deg(i) * 0.75,
+                     particle->param2 * az_sin_deg(i));
         }
       } glEnd();
     } break;
@@ -107,9 +107,9 @@ void az_draw_particle(const az_particle_t *particle, az_clock_t clock) {
         const double outer = major + minor;
         for (int i = 0; i <= 360; i += 10) {
           with_color_alpha(particle->color, 0);
-          glVertex2d(outer * cos(AZ_DEG2RAD(i)), outer * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(outer, i);
           with_color_alpha(particle->color, alpha);
-          glVertex2d(major * cos(AZ_DEG2RAD(i)), major * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(major, i);
         }
       } glEnd();
       glBegin(GL_QUAD_STRIP); {
@@ -117,24 +117,19 @@ void az_draw_particle(const az_particle_t *particle, az_clock_t clock) {
         const double beta = alpha * (1 - fmin(major, minor) / minor);
         for (int i = 0; i <= 360; i += 10) {
           with_color_alpha(particle->color, alpha);
-          glVertex2d(major * cos(AZ_DEG2RAD(i)), major * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(major, i);
           with_color_alpha(particle->color, beta);
-          glVertex2d(inner * cos(AZ_DEG2RAD(i)), inner * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(inner, i);
         }
       } glEnd();
     } break;
-    case AZ_PAR_EMBER:
-      glBegin(GL_TRIANGLE_FAN); {
-        with_color_alpha(particle->color, 1);
-        glVertex2f(0, 0);
-        with_color_alpha(particle->color, 0);
-        const double radius =
-          particle->param1 * (1.0 - particle->age / particle->lifetime);
-        for (int i = 0; i <= 360; i += 30) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
-        }
-      } glEnd();
-      break;
+    case AZ_PAR_EMBER: {
+      az_color_t rim_color = particle->color;
+      rim_color.a = 0;
+      az_draw_glow_ball(
+          particle->param1 * (1.0 - particle->age / particle->lifetime), 30,
+          particle->color, rim_color);
+    } break;
     case AZ_PAR_EXPLOSION:
       glBegin(GL_QUAD_STRIP); {
         const double tt = 1.0 - particle->age / particle->lifetime;
@@ -143,7 +138,7 @@ void az_draw_particle(const az_particle_t *particle, az_clock_t clock) {
         const double inner_radius = particle->param1 * (1.0 - tt * tt * tt);
         const double outer_radius = particle->param1;
         for (int i = 0; i <= 360; i += 6) {
-          const double c = cos(AZ_DEG2RAD(i)), s = sin(AZ_DEG2RAD(i));
+          const double c = az_cos_deg(i), s = az_sin_deg(i);
           with_color_alpha(particle->color, inner_alpha);
           glVertex2d(inner_radius * c, inner_radius * s);
           with_color_alpha(particle->color, outer_alpha);
@@ -161,17 +156,15 @@ void az_draw_particle(const az_particle_t *particle, az_clock_t clock) {
           const int limit = 180 * liveness;
           for (int j = 0; j < limit; j += 20) {
             glColor4f(1.0, 0.75 * j / limit, 0.0,
-                      0.35 + 0.25 * sin(AZ_DEG2RAD(i)) * sin(AZ_DEG2RAD(j)) -
+                      0.35 + 0.25 * az_sin_deg(i) * az_sin_deg(j) -
                       0.35 * j / limit);
-            const double x = x_radius * cos(AZ_DEG2RAD(j));
-            glVertex2d(x, y_radius * cos(AZ_DEG2RAD(i)) *
-                       sin(AZ_DEG2RAD(j)));
-            glVertex2d(x, y_radius * cos(AZ_DEG2RAD(i + i_step)) *
-                       sin(AZ_DEG2RAD(j)));
+            const double x = x_radius * az_cos_deg(j);
+            glVertex2d(x, y_radius * az_cos_deg(i) * az_sin_deg(j));
+            glVertex2d(x, y_radius * az_cos_deg(i + i_step) * az_sin_deg(j));
           }
-          glVertex2d(x_radius * cos(AZ_DEG2RAD(limit)),
-                     y_radius * cos(AZ_DEG2RAD(i + i_step/2)) *
-                     sin(AZ_DEG2RAD(limit)));
+          glVertex2d(x_radius * az_cos_deg(limit),
+                     y_radius * az_cos_deg(i + i_step/2) *
+                     az_sin_deg(limit));
         } glEnd();
       }
     } break;
@@ -182,10 +175,7 @@ void az_draw_particle(const az_particle_t *particle, az_clock_t clock) {
         with_color_alpha(particle->color, 0);
         glVertex2f(0, 0);
         with_color_alpha(particle->color, t1 * t1 * t1);
-        for (int i = 0; i <= 360; i += 6) {
-          glVertex2d(particle->param1 * cos(AZ_DEG2RAD(i)),
-                     particle->param1 * sin(AZ_DEG2RAD(i)));
-        }
+        az_gl_circle_vertices(particle->param1, 6);
       } glEnd();
       glPushMatrix(); {
         const double rx = 0.65 * particle->param1;
@@ -247,8 +237,7 @@ void az_draw_particle(const az_particle_t *particle, az_clock_t clock) {
                      (az_clock_mod(6, 1, clk + 2) < 3 ? color.g : color.g / 4),
                      (az_clock_mod(6, 1, clk + 4) < 3 ? color.b : color.b / 4),
                      color.a);
-          glVertex2d(radius * cos(AZ_DEG2RAD(i * 120)),
-                     radius * sin(AZ_DEG2RAD(i * 120)));
+          az_gl_vertex_polar_deg(radius, i * 120);
         }
       } glEnd();
       break;
@@ -282,10 +271,7 @@ void az_draw_particle(const az_particle_t *particle, az_clock_t clock) {
         glColor4f(r, g, b, 1.0f);
         glVertex2f(0, 0);
         glColor4f(r, g, b, 0.15f);
-        const double radius = particle->param1 * scale;
-        for (int i = 0; i <= 360; i += 10) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
-        }
+        az_gl_circle_vertices(particle->param1 * scale, 10);
       } glEnd();
     } break;
     case AZ_PAR_ROCK:
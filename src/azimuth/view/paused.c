@@ -22,6 +22,7 @@
 #include <assert.h>
 #include <math.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 #include <GL/gl.h>
@@ -177,14 +178,47 @@ static az_vector_t minimap_room_center(const az_paused_state_t *state,
 /*===========================================================================*/
 // Drawing minimap:
 
-static void draw_minimap_rooms(const az_paused_state_t *state,
-                               az_room_flags_t *room_flags_out) {
+// The set of mapped rooms only changes when the player visits a new room or
+// gains map data for a zone, so rather than redrawing every room each frame,
+// we compile them into a display list and only recompile it when the player's
+// rooms_visited or zones_mapped bits change.
+static GLuint minimap_display_list;
+static struct {
+  bool valid;
+  const az_planet_t *planet;
+  uint64_t rooms_visited[(AZ_MAX_NUM_ROOMS + 63) / 64];
+  uint64_t zones_mapped[(AZ_MAX_NUM_ZONES + 63) / 64];
+  az_room_flags_t room_flags;
+} minimap_cache;
+
+void az_init_paused_drawing(void) {
+  minimap_display_list = glGenLists(1);
+  if (minimap_display_list == 0u) {
+    AZ_FATAL("glGenLists failed.\n");
+  }
+  minimap_cache.valid = false;
+}
+
+static bool minimap_cache_is_valid(const az_paused_state_t *state) {
+  const az_player_t *player = &state->ship->player;
+  AZ_STATIC_ASSERT(sizeof(minimap_cache.rooms_visited) ==
+                   sizeof(player->rooms_visited));
+  AZ_STATIC_ASSERT(sizeof(minimap_cache.zones_mapped) ==
+                   sizeof(player->zones_mapped));
+  return (minimap_cache.valid && minimap_cache.planet == state->planet &&
+          memcmp(minimap_cache.rooms_visited, player->rooms_visited,
+                 sizeof(player->rooms_visited)) == 0 &&
+          memcmp(minimap_cache.zones_mapped, player->zones_mapped,
+                 sizeof(player->zones_mapped)) == 0);
+}
+
+static void compile_minimap_rooms(const az_paused_state_t *state,
+                                  az_room_flags_t *room_flags_out) {
   // Draw planet surface outline:
   glColor3f(1, 1, 0); // yellow
   glBegin(GL_LINE_STRIP); {
     for (int i = 45; i <= 135; i += 3) {
-      glVertex2d(AZ_PLANETOID_RADIUS * cos(AZ_DEG2RAD(i)),
-                 AZ_PLANETOID_RADIUS * sin(AZ_DEG2RAD(i)));
+      az_gl_vertex_polar_deg(AZ_PLANETOID_RADIUS, i);
     }
   } glEnd();
 
@@ -206,6 +240,26 @@ static void draw_minimap_rooms(const az_paused_state_t *state,
   }
 }
 
+static void draw_minimap_rooms(const az_paused_state_t *state,
+                               az_room_flags_t *room_flags_out) {
+  if (!minimap_cache_is_valid(state)) {
+    const az_player_t *player = &state->ship->player;
+    minimap_cache.room_flags = 0;
+    glNewList(minimap_display_list, GL_COMPILE); {
+      compile_minimap_rooms(state, &minimap_cache.room_flags);
+    } glEndList();
+    minimap_cache.planet = state->planet;
+    memcpy(minimap_cache.rooms_visited, player->rooms_visited,
+           sizeof(player->rooms_visited));
+    memcpy(minimap_cache.zones_mapped, player->zones_mapped,
+           sizeof(player->zones_mapped));
+    minimap_cache.valid = true;
+  }
+  assert(glIsList(minimap_display_list));
+  glCallList(minimap_display_list);
+  *room_flags_out |= minimap_cache.room_flags;
+}
+
 static void draw_map_markers(const az_paused_state_t *state) {
   const az_planet_t *planet = state->planet;
   const az_player_t *player = &state->ship->player;
@@ -489,8 +543,8 @@ static void draw_schematic_line(az_clock_t clock, const az_vector_t *vertices,
     az_gl_vertex(center);
     const double radius = 3.0;
     for (int i = 0; i <= 360; i += 30) {
-      glVertex2d(center.x + radius * cos(AZ_DEG2RAD(i)),
-                 center.y + radius * sin(AZ_DEG2RAD(i)));
+      glVertex2d(center.x + radius * az_cos_deg(i),
+                 center.y + radius * az_sin_deg(i));
     }
   } glEnd();
 }
@@ -66,6 +66,11 @@ typedef struct {
   double quitting_fade_alpha; // 0.0 to 1.0
 } az_paused_state_t;
 
+// Call this at program startup to initialize drawing of the pause screen.
+// This must be called _after_ az_init_gui, and must be called _before_ any
+// calls to az_paused_draw_screen.
+void az_init_paused_drawing(void);
+
 void az_init_paused_state(
     az_paused_state_t *state, const az_planet_t *planet,
     const az_preferences_t *prefs, az_ship_t *ship);
@@ -69,7 +69,7 @@ static const az_polygon_t picker_polygon =
 
 #define CHECKBOX_WIDTH PICKER_HEIGHT
 #define CHECKBOX_HEIGHT PICKER_HEIGHT
-#define CHECKBOX_SPACING PICKER_VERT_SPACING
+#define CHECKBOX_SPACING 5
 
 static const az_vector_t checkbox_vertices[] = {
   {0.5, 0.5}, {CHECKBOX_WIDTH - 0.5, 0.5},
@@ -142,6 +142,14 @@ void az_init_prefs_pane(az_prefs_pane_t *pane, int x, int y,
                  checkbox_left,
                  checkbox_top + 2 * (CHECKBOX_HEIGHT + CHECKBOX_SPACING));
   pane->enable_hints_checkbox.checked = prefs->enable_hints;
+  az_init_button(&pane->low_latency_checkbox.button, checkbox_polygon,
+                 checkbox_left,
+                 checkbox_top + 3 * (CHECKBOX_HEIGHT + CHECKBOX_SPACING));
+  pane->low_latency_checkbox.checked = prefs->low_latency_input;
+  az_init_button(&pane->pipelined_checkbox.button, checkbox_polygon,
+                 checkbox_left,
+                 checkbox_top + 4 * (CHECKBOX_HEIGHT + CHECKBOX_SPACING));
+  pane->pipelined_checkbox.checked = prefs->pipelined_drawing;
 }
 
 /*===========================================================================*/
@@ -223,6 +231,8 @@ void az_draw_prefs_pane(const az_prefs_pane_t *pane) {
     draw_checkbox(&pane->speedrun_timer_checkbox, "Show speedrun timer");
     draw_checkbox(&pane->fullscreen_checkbox, "Fullscreen on startup");
     draw_checkbox(&pane->enable_hints_checkbox, "Enable hint system");
+    draw_checkbox(&pane->low_latency_checkbox, "Low-latency input");
+    draw_checkbox(&pane->pipelined_checkbox, "Pipelined drawing");
 
     draw_key_picker(&pane->pickers[AZ_CONTROL_BOMBS], "Bombs");
     draw_key_picker(&pane->pickers[AZ_CONTROL_CHARGE], "Charge");
@@ -285,6 +295,10 @@ void az_tick_prefs_pane(az_prefs_pane_t *pane, bool visible, double time,
                  pane->x, pane->y, active, time, clock, soundboard);
   az_tick_button(&pane->enable_hints_checkbox.button,
                  pane->x, pane->y, active, time, clock, soundboard);
+  az_tick_button(&pane->low_latency_checkbox.button,
+                 pane->x, pane->y, active, time, clock, soundboard);
+  az_tick_button(&pane->pipelined_checkbox.button,
+                 pane->x, pane->y, active, time, clock, soundboard);
 }
 
 /*===========================================================================*/
@@ -320,6 +334,8 @@ void az_prefs_pane_on_click(az_prefs_pane_t *pane, int abs_x, int abs_y,
                       soundboard);
     checkbox_on_click(&pane->fullscreen_checkbox, rel_x, rel_y, soundboard);
     checkbox_on_click(&pane->enable_hints_checkbox, rel_x, rel_y, soundboard);
+    checkbox_on_click(&pane->low_latency_checkbox, rel_x, rel_y, soundboard);
+    checkbox_on_click(&pane->pipelined_checkbox, rel_x, rel_y, soundboard);
   }
 }
 
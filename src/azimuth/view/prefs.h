@@ -55,6 +55,8 @@ typedef struct {
   az_prefs_checkbox_t speedrun_timer_checkbox;
   az_prefs_checkbox_t fullscreen_checkbox;
   az_prefs_checkbox_t enable_hints_checkbox;
+  az_prefs_checkbox_t low_latency_checkbox;
+  az_prefs_checkbox_t pipelined_checkbox;
   int selected_key_picker_index; // -1 for none
 } az_prefs_pane_t;
 
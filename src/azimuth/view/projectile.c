@@ -146,8 +146,7 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
           double r = 5.0 - 2.0 * (i % 2);
           if (proj->kind == AZ_PROJ_GUN_CHARGED_FREEZE) r *= 1.5;
           else if (proj->kind == AZ_PROJ_GUN_FREEZE_SHRAPNEL) r *= 0.75;
-          double t = AZ_DEG2RAD(30 * i + 3 * az_clock_mod(120, 1, clock));
-          glVertex2d(r * cos(t), r * sin(t));
+          az_gl_vertex_polar_deg(r, 30 * i + 3 * az_clock_mod(120, 1, clock));
         }
       } glEnd();
       break;
@@ -196,9 +195,7 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
       else glColor3f(1, 0, 1);
       glBegin(GL_TRIANGLE_FAN); {
         glVertex2f(0, 0);
-        for (int i = -90; i <= 90; i += 30) {
-          glVertex2d(4 * cos(AZ_DEG2RAD(i)), 4 * sin(AZ_DEG2RAD(i)));
-        }
+        az_gl_arc_vertices(4, 4, -90, 90, 30);
       } glEnd();
       glBegin(GL_TRIANGLE_STRIP); {
         glVertex2f(0, -4); glVertex2f(0, 4);
@@ -270,18 +267,11 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
         glVertex2f(-8, 5); glVertex2f(6, 0); glVertex2f(-8, -5);
       } glEnd();
       break;
-    case AZ_PROJ_GUN_CHARGED_BEAM:
-      glBegin(GL_TRIANGLE_FAN); {
-        const double ratio = proj->age / proj->data->lifetime;
-        const double radius = proj->data->splash_radius * ratio;
-        glColor4f(1, 0, 0, 0);
-        glVertex2f(0, 0);
-        glColor4f(1, 0, 0, 1 - ratio);
-        for (int i = 0; i <= 360; i += 15) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
-        }
-      } glEnd();
-      break;
+    case AZ_PROJ_GUN_CHARGED_BEAM: {
+      const double ratio = proj->age / proj->data->lifetime;
+      az_draw_glow_ball(proj->data->splash_radius * ratio, 15,
+                        az_color4f(1, 0, 0, 0), az_color4f(1, 0, 0, 1 - ratio));
+    } break;
     case AZ_PROJ_ROCKET:
       draw_rocket(clock, (az_color_t){128, 0, 0, 255});
       break;
@@ -312,8 +302,7 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
         glColor4f(1, 0, 0, 0);
         for (int i = 0; i <= 360; i += 45) {
           const double radius = (i % 2 ? 30.0 : 10.0);
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)),
-                     radius * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(radius, i);
         }
       } glEnd();
       break;
@@ -325,7 +314,7 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
         for (int i = 0, blue = 0; i <= 360; i += 60, blue = !blue) {
           if (blue) glColor3f(0, 0, 0.75); // blue
           else glColor3f(0.5, 0.5, 0.5); // gray
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(radius, i);
         }
       } glEnd();
       break;
@@ -342,7 +331,7 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
           if (blue) glColor3f(0, 0.5, 0.75); // cyan
           else if (blink) glColor3f(0.75, 0.75, 0.25); // yellow
           else glColor3f(0.25, 0.25, 0.25); // dark gray
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(radius, i);
         }
       } glEnd();
       break;
@@ -354,7 +343,7 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
         for (int i = 0, blue = 0; i <= 360; i += 60, blue = !blue) {
           if (blue) glColor3f(0, 0.5, 0.75); // blue-green
           else glColor3f(0.5, 0.5, 0.5); // gray
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(radius, i);
         }
       } glEnd();
       break;
@@ -365,11 +354,9 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
         const double inner = fmax(0.0, outer - 100 * (1.0 - factor));
         for (int i = 0; i <= 360; i += 10) {
           glColor4f(1, 1, 1, 0.7);
-          glVertex2d(outer * cos(AZ_DEG2RAD(i)),
-                     0.7 * outer * sin(AZ_DEG2RAD(i)));
+          glVertex2d(outer * az_cos_deg(i), 0.7 * outer * az_sin_deg(i));
           glColor4f(0.5, 0.75, 1, 0.3);
-          glVertex2d(inner * cos(AZ_DEG2RAD(i)),
-                     0.7 * inner * sin(AZ_DEG2RAD(i)));
+          glVertex2d(inner * az_cos_deg(i), 0.7 * inner * az_sin_deg(i));
         }
       } glEnd();
       break;
@@ -389,7 +376,7 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
                                proj->kind == AZ_PROJ_ORBITAL_TORPEDO ||
                                proj->kind == AZ_PROJ_ERUPTION ? 18.0 : 6.0);
         for (int i = 0; i <= 360; i += 30) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(radius, i);
         }
       } glEnd();
       break;
@@ -439,8 +426,8 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
         glColor3f(0, 1, 1);
         glVertex2f(5, 0);
         for (int i = 0; i <= 360; i += 20) {
-          glColor4f(0, 0.5, 0.5, 0.5 + 0.5 * cos(AZ_DEG2RAD(i)));
-          glVertex2d(9.0 * cos(AZ_DEG2RAD(i)), 7.0 * sin(AZ_DEG2RAD(i)));
+          glColor4f(0, 0.5, 0.5, 0.5 + 0.5 * az_cos_deg(i));
+          glVertex2d(9.0 * az_cos_deg(i), 7.0 * az_sin_deg(i));
         }
       } glEnd();
       break;
@@ -467,9 +454,8 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
           glVertex2f(0, 0);
           glColor3f(0.6, 0.3, 0.0);
           for (int i = 0; i < 360; i += 120) {
-            glVertex2d(8 * cos(AZ_DEG2RAD(i)), 8 * sin(AZ_DEG2RAD(i)));
-            glVertex2d(2.5 * cos(AZ_DEG2RAD(i + 10)),
-                       2.5 * sin(AZ_DEG2RAD(i + 10)));
+            az_gl_vertex_polar_deg(8, i);
+            az_gl_vertex_polar_deg(2.5, i + 10);
           }
           glVertex2d(6, 0);
         } glEnd();
@@ -483,23 +469,18 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
         glVertex2d(0.25 * radius, 0);
         glColor3f(0.1, 0.3, 0.15);
         for (int i = 0; i <= 360; i += 15) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+          az_gl_vertex_polar_deg(radius, i);
         }
       } glEnd();
       break;
     case AZ_PROJ_NUCLEAR_EXPLOSION: break; // invisible
     case AZ_PROJ_OTH_BARRAGE: break; // invisible
-    case AZ_PROJ_OTH_CHARGED_BEAM:
-      glBegin(GL_TRIANGLE_FAN); {
-        const double ratio = proj->age / proj->data->lifetime;
-        const double radius = proj->data->splash_radius * ratio;
-        glColor4f(0.85, 1, 0.5, 0); glVertex2f(0, 0);
-        glColor4f(0.85, 1, 0.5, 1 - ratio);
-        for (int i = 0; i <= 360; i += 15) {
-          glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
-        }
-      } glEnd();
-      break;
+    case AZ_PROJ_OTH_CHARGED_BEAM: {
+      const double ratio = proj->age / proj->data->lifetime;
+      az_draw_glow_ball(proj->data->splash_radius * ratio, 15,
+                        az_color4f(0.85, 1, 0.5, 0),
+                        az_color4f(0.85, 1, 0.5, 1 - ratio));
+    } break;
     case AZ_PROJ_OTH_CHARGED_PHASE:
       draw_oth_projectile(proj, 7.0, clock);
       break;
@@ -521,13 +502,11 @@ void az_draw_projectile(const az_projectile_t *proj, az_clock_t clock) {
           glColor4f((az_clock_mod(6, 1, clock)     < 3 ? 1.0f : 0.5f),
                     (az_clock_mod(6, 1, clock + 2) < 3 ? 1.0f : 0.5f),
                     (az_clock_mod(6, 1, clock + 4) < 3 ? 1.0f : 0.5f), 0.7f);
-          glVertex2d(outer * cos(AZ_DEG2RAD(i)),
-                     0.7 * outer * sin(AZ_DEG2RAD(i)));
+          glVertex2d(outer * az_cos_deg(i), 0.7 * outer * az_sin_deg(i));
           glColor4f((az_clock_mod(6, 1, clock)     < 3 ? 0.75f : 0.25f),
                     (az_clock_mod(6, 1, clock + 2) < 3 ? 0.75f : 0.25f),
                     (az_clock_mod(6, 1, clock + 4) < 3 ? 0.75f : 0.25f), 0.3f);
-          glVertex2d(inner * cos(AZ_DEG2RAD(i)),
-                     0.7 * inner * sin(AZ_DEG2RAD(i)));
+          glVertex2d(inner * az_cos_deg(i), 0.7 * inner * az_sin_deg(i));
         }
       } glEnd();
       break;
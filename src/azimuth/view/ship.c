@@ -239,9 +239,9 @@ void az_draw_ship_body(const az_ship_t *ship, az_clock_t clock) {
               glVertex2d(0, 0);
               glColor4f(1, 1, 1, 0.0);
               for (int i = 0; i <= 360; i += 60) {
-                const double degrees = (n == 0 ? i + offset : i - offset);
-                glVertex2d(radius * cos(AZ_DEG2RAD(degrees)),
-                           radius * sin(AZ_DEG2RAD(degrees)));
+                const int degrees = (n == 0 ? i + offset : i - offset);
+                glVertex2d(radius * az_cos_deg(degrees),
+                           radius * az_sin_deg(degrees));
               }
             } glEnd();
           }
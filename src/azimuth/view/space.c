@@ -140,7 +140,7 @@ static void draw_darkness(az_space_state_t *state) {
       glVertex2f(0, 0);
       glColor4f(0, 0, blue, alpha);
       for (int i = 90; i <= 270; i += 10) {
-        glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius, i);
       }
     } glEnd();
     glBegin(GL_TRIANGLE_STRIP); {
@@ -160,7 +160,7 @@ static void draw_darkness(az_space_state_t *state) {
       glVertex2f(1000, radius + spread);
       glVertex2f(1000, 1000);
       for (int i = 90; i <= 270; i += 10) {
-        const double c = cos(AZ_DEG2RAD(i)), s = sin(AZ_DEG2RAD(i));
+        const double c = az_cos_deg(i), s = az_sin_deg(i);
         glVertex2d(radius * c, radius * s);
         glVertex2d(1000 * c, 1000 * s);
       }
@@ -174,12 +174,12 @@ static void draw_darkness(az_space_state_t *state) {
       glVertex2f(0, 0);
       glColor4f(0, 0, blue, alpha);
       for (int i = 0; i <= 360; i += 10) {
-        glVertex2d(radius * cos(AZ_DEG2RAD(i)), radius * sin(AZ_DEG2RAD(i)));
+        az_gl_vertex_polar_deg(radius, i);
       }
     } glEnd();
     glBegin(GL_TRIANGLE_STRIP); {
       for (int i = 0; i <= 360; i += 10) {
-        const double c = cos(AZ_DEG2RAD(i)), s = sin(AZ_DEG2RAD(i));
+        const double c = az_cos_deg(i), s = az_sin_deg(i);
         glVertex2d(radius * c, radius * s);
         glVertex2d(1000 * c, 1000 * s);
       }
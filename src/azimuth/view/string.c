@@ -23,6 +23,7 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <GL/gl.h>
@@ -164,20 +165,37 @@ static struct {
   ['~'] = {GL_LINE_STRIP, 4, {{0,4}, {2,2}, {4,4}, {6,2}}}
 };
 
-static void draw_char(int c) {
-  if (c >= 0 && c < AZ_ARRAY_SIZE(char_specs) &&
-      char_specs[c].num_points > 0) {
-    glBegin(char_specs[c].mode); {
-      for (int i = 0; i < char_specs[c].num_points; ++i) {
-        glVertex2f(char_specs[c].points[i].x, char_specs[c].points[i].y);
+// Each glyph is compiled into its own display list, which draws the glyph and
+// then advances the current position by one character width, so that a whole
+// run of characters can be submitted with a single glCallLists.  There is one
+// list for every possible byte value, so that glCallLists can be given a
+// string directly (bytes with no glyph only advance the position).
+#define NUM_GLYPH_DISPLAY_LISTS 256
+static GLuint glyph_display_lists_start = 0u;
+
+void az_init_string_drawing(void) {
+  glyph_display_lists_start = glGenLists(NUM_GLYPH_DISPLAY_LISTS);
+  if (glyph_display_lists_start == 0u) {
+    AZ_FATAL("glGenLists failed.\n");
+  }
+  for (int c = 0; c < NUM_GLYPH_DISPLAY_LISTS; ++c) {
+    glNewList(glyph_display_lists_start + c, GL_COMPILE); {
+      if (c < AZ_ARRAY_SIZE(char_specs) && char_specs[c].num_points > 0) {
+        glBegin(char_specs[c].mode); {
+          for (int i = 0; i < char_specs[c].num_points; ++i) {
+            glVertex2f(char_specs[c].points[i].x, char_specs[c].points[i].y);
+          }
+        } glEnd();
       }
-    } glEnd();
+      glTranslatef(FONT_SIZE, 0, 0);
+    } glEndList();
   }
 }
 
 static void draw_chars_internal(
     double height, az_alignment_t align, double x, double top, bool italic,
     const char *chars, size_t len) {
+  assert(glIsList(glyph_display_lists_start));
   double left = x;
   switch (align) {
     case AZ_ALIGN_LEFT: break;
@@ -195,10 +213,8 @@ static void draw_chars_internal(
         2,    0, 0, 1};
       glMultMatrixf(italic_matrix);
     }
-    for (size_t i = 0; i < len; ++i) {
-      draw_char(chars[i]);
-      glTranslated(FONT_SIZE, 0, 0);
-    }
+    glListBase(glyph_display_lists_start);
+    glCallLists(len, GL_UNSIGNED_BYTE, chars);
   } glPopMatrix();
 }
 
@@ -255,64 +271,88 @@ static bool hex_parse(char c1, char c2, uint8_t *out) {
   return true;
 }
 
-void az_draw_paragraph(
-    double height, az_alignment_t align, double x, double top, double spacing,
-    int max_chars, const az_preferences_t *prefs, const char *paragraph) {
-  assert(prefs != NULL);
-  assert(paragraph != NULL);
-  // Start out with white, non-italic text.
-  glColor3f(1, 1, 1);
-  bool italic = false;
-  // Draw each line of text, one per outer loop iteration.  We will return from
-  // this function when we reach the end (NUL character) of the paragraph, or
-  // after printing max_chars characters.
-  int chars_printed = 0; // how many chars we've printed so far
-  int chars_before_line = 0; // how many chars we'd printed when line started
-  int line_pauses = 0; // how many chars "printed" on this line were pauses
-  int line_start = 0; // index into paragraph for first char of current line
-  double line_top = top; // y-position of top of the current line
+// Parsing a paragraph's $-escapes (and measuring each line for alignment) is
+// done once per paragraph; the result is a flat list of drawing operations,
+// which we cache keyed by the paragraph's address (and the key bindings that
+// were used to expand key-name escapes).  Drawing the paragraph each frame
+// then just replays the operations, stopping after max_chars characters.
+
+typedef enum {
+  PARA_OP_LINE, // start a new line with the given length (in chars)
+  PARA_OP_TEXT, // draw a fragment of text
+  PARA_OP_KEY, // draw the name of a key
+  PARA_OP_PAUSE, // pause for the given number of chars
+  PARA_OP_COLOR, // set the current color
+  PARA_OP_ITALIC // set whether the font is italic
+} az_para_op_kind_t;
+
+typedef struct {
+  az_para_op_kind_t kind;
+  int value; // line length, text length, pause length, or italic flag
+  const char *chars; // for PARA_OP_TEXT and PARA_OP_KEY
+  GLfloat red, green, blue; // for PARA_OP_COLOR
+} az_para_op_t;
+
+typedef struct {
+  const char *paragraph; // NULL if this cache entry is unused
+  size_t paragraph_length;
+  az_key_id_t key_for_control[AZ_NUM_CONTROLS];
+  int num_ops;
+  az_para_op_t *ops;
+} az_para_layout_t;
+
+#define NUM_CACHED_PARAGRAPHS 32
+static az_para_layout_t para_layouts[NUM_CACHED_PARAGRAPHS];
+static int next_para_layout_index = 0;
+
+static void add_color_op(az_para_layout_t *layout, GLfloat red, GLfloat green,
+                         GLfloat blue) {
+  layout->ops[layout->num_ops++] = (az_para_op_t){
+    .kind = PARA_OP_COLOR, .red = red, .green = green, .blue = blue };
+}
+
+// Parse the paragraph into drawing operations.  The layout's paragraph and
+// key_for_control fields must already be set.
+static void parse_paragraph(const az_preferences_t *prefs,
+                            az_para_layout_t *layout) {
+  const char *paragraph = layout->paragraph;
+  // Every fragment and escape turns into at most one operation, and every
+  // fragment is followed by either an escape, a newline, or the end of the
+  // string, so this is an upper bound on the number of operations we need.
+  int max_ops = 2;
+  for (const char *ch = paragraph; *ch != '\0'; ++ch) {
+    if (*ch == '$' || *ch == '\n') max_ops += 3;
+  }
+  layout->ops = AZ_ALLOC(max_ops, az_para_op_t);
+  layout->num_ops = 0;
   const az_key_id_t *key_for_control = prefs->key_for_control;
+  // Parse each line of text, one per outer loop iteration.  We will return
+  // from this function when we reach the end (NUL character) of the paragraph.
+  int line_start = 0; // index into paragraph for first char of current line
   while (true) {
-    // Determine the x-position of the left side of this line.  For alignments
-    // other than AZ_ALIGN_LEFT, this will require calculating the length of
-    // the line.
-    double line_left = x;
-    if (align != AZ_ALIGN_LEFT) {
-      const int line_length =
-        az_paragraph_line_length(prefs, paragraph, line_start);
-      if (align == AZ_ALIGN_RIGHT) line_left -= line_length * height;
-      else {
-        assert(align == AZ_ALIGN_CENTER);
-        line_left -= 0.5 * (line_length * height - 0.25 * height);
-      }
-    }
-    // Draw the individual fragments of text making up this line, one per loop
-    // iteration.  Fragments are bounded by $-escapes.
+    layout->ops[layout->num_ops++] = (az_para_op_t){
+      .kind = PARA_OP_LINE,
+      .value = az_paragraph_line_length(prefs, paragraph, line_start) };
+    // Parse the individual fragments of text making up this line, one per
+    // loop iteration.  Fragments are bounded by $-escapes.
     int fragment_start = line_start;
     while (true) {
-      const double fragment_left =
-        line_left + height * (chars_printed - line_pauses - chars_before_line);
-      // Determine where the fragment ends.  It ends at the next $-escape, at
-      // the end of the line (or of the whole string), or when we reach
-      // max_chars printed characters -- whichever comes first.
+      // Determine where the fragment ends.  It ends at the next $-escape, or
+      // at the end of the line (or of the whole string).
       int fragment_end = fragment_start;
       while (paragraph[fragment_end] != '\0' &&
              paragraph[fragment_end] != '\n' &&
              paragraph[fragment_end] != '$') {
-        if (chars_printed == max_chars) break;
-        ++chars_printed;
         ++fragment_end;
       }
-      // Draw the fragment (if it's non-empty).
+      // Add the fragment (if it's non-empty).
       if (fragment_end > fragment_start) {
-        draw_chars_internal(height, AZ_ALIGN_LEFT, fragment_left, line_top,
-                            italic, paragraph + fragment_start,
-                            fragment_end - fragment_start);
+        layout->ops[layout->num_ops++] = (az_para_op_t){
+          .kind = PARA_OP_TEXT, .chars = paragraph + fragment_start,
+          .value = fragment_end - fragment_start };
       }
-      // If we've printed max_chars characters, or we're at the end of the
-      // string, we're completely done.
-      if (chars_printed == max_chars) return;
-      if (paragraph[fragment_end] == '\0') return;
+      // If we're at the end of the string, we're completely done.
+      if (paragraph[fragment_end] == '\0') goto done;
       // Otherwise, check if this is the end of the line; if so, the next line
       // will begin at fragment_start.
       fragment_start = fragment_end + 1;
@@ -328,7 +368,7 @@ void az_draw_paragraph(
         // string, print a warning and stop.
         case '\0':
           AZ_WARNING_ONCE("Incomplete $-escape\n");
-          return;
+          goto done;
         // The escape "$$" means to insert a single literal '$' character.  We
         // can just back up fragment_start by one so that the second '$' is
         // included as the beginning of the next fragment.
@@ -342,18 +382,15 @@ void az_draw_paragraph(
               paragraph[fragment_start + 1] == '\0') {
             AZ_WARNING_ONCE("Incomplete $_ escape: $_%s\n",
                             paragraph + fragment_start);
-            return;
+            goto done;
           }
           // Parse out the decimal value.  If it's valid, pause appropriately;
           // if not, print a warning and then just ignore the whole escape.
           int pause;
           if (decimal_parse(paragraph[fragment_start + 0],
                             paragraph[fragment_start + 1], &pause)) {
-            if (pause > max_chars - chars_printed) {
-              pause = max_chars - chars_printed;
-            }
-            chars_printed += pause;
-            line_pauses += pause;
+            layout->ops[layout->num_ops++] = (az_para_op_t){
+              .kind = PARA_OP_PAUSE, .value = pause };
           } else {
             AZ_WARNING_ONCE("Malformed $_ escape: $_%.2s\n",
                             paragraph + fragment_start);
@@ -361,18 +398,21 @@ void az_draw_paragraph(
           fragment_start += 2;
         } break;
         // Handle italics controls:
-        case '/': italic = true; break;
-        case '|': italic = false; break;
+        case '/':
+        case '|':
+          layout->ops[layout->num_ops++] = (az_para_op_t){
+            .kind = PARA_OP_ITALIC, .value = (escape == '/') };
+          break;
         // Handle color escapes:
-        case 'A': glColor3f(0.5, 0.5, 0.5); break; // grAy
-        case 'B': glColor3f(0, 0, 1); break; // Blue
-        case 'C': glColor3f(0, 1, 1); break; // Cyan
-        case 'G': glColor3f(0, 1, 0); break; // Green
-        case 'M': glColor3f(1, 0, 1); break; // Magenta
-        case 'O': glColor3f(1, 0.5, 0); break; // Orange
-        case 'R': glColor3f(1, 0, 0); break; // Red
-        case 'W': glColor3f(1, 1, 1); break; // White
-        case 'Y': glColor3f(1, 1, 0); break; // Yellow
+        case 'A': add_color_op(layout, 0.5, 0.5, 0.5); break; // grAy
+        case 'B': add_color_op(layout, 0, 0, 1); break; // Blue
+        case 'C': add_color_op(layout, 0, 1, 1); break; // Cyan
+        case 'G': add_color_op(layout, 0, 1, 0); break; // Green
+        case 'M': add_color_op(layout, 1, 0, 1); break; // Magenta
+        case 'O': add_color_op(layout, 1, 0.5, 0); break; // Orange
+        case 'R': add_color_op(layout, 1, 0, 0); break; // Red
+        case 'W': add_color_op(layout, 1, 1, 1); break; // White
+        case 'Y': add_color_op(layout, 1, 1, 0); break; // Yellow
         case 'X': // heX
           // First, make sure that we won't hit the end of the string trying to
           // read the next six characters after the "$X".  If we will, print a
@@ -381,7 +421,7 @@ void az_draw_paragraph(
             if (paragraph[fragment_start + i] == '\0') {
               AZ_WARNING_ONCE("Incomplete $X escape: $X%s\n",
                               paragraph + fragment_start);
-              return;
+              goto done;
             }
           }
           // Parse out the RGB hex values.  If they're valid, set the current
@@ -395,7 +435,8 @@ void az_draw_paragraph(
                           paragraph[fragment_start + 3], &green) &&
                 hex_parse(paragraph[fragment_start + 4],
                           paragraph[fragment_start + 5], &blue)) {
-              glColor3ub(red, green, blue);
+              add_color_op(layout, red / 255.0f, green / 255.0f,
+                           blue / 255.0f);
             } else {
               AZ_WARNING_ONCE("Malformed $X escape: $X%.6s\n",
                               paragraph + fragment_start);
@@ -430,27 +471,113 @@ void az_draw_paragraph(
           break;
       }
       // If the escape we just saw was for a key name, look up the name of that
-      // key and print it, advancing chars_printed by the length of the name.
-      // Of course, if our max_chars falls in the middle of the key name, we'll
-      // have to cut the key name short.
+      // key and add it.
       if (key_id != AZ_KEY_UNKNOWN) {
         const char *key_name = az_key_name(key_id);
-        int len = strlen(key_name);
+        layout->ops[layout->num_ops++] = (az_para_op_t){
+          .kind = PARA_OP_KEY, .chars = key_name, .value = strlen(key_name) };
+      }
+    }
+    // Advance to the next line.
+    line_start = fragment_start;
+  }
+ done:
+  assert(layout->num_ops <= max_ops);
+}
+
+static const az_para_layout_t *get_paragraph_layout(
+    const az_preferences_t *prefs, const char *paragraph) {
+  const size_t paragraph_length = strlen(paragraph);
+  AZ_ARRAY_LOOP(layout, para_layouts) {
+    if (layout->paragraph == paragraph &&
+        layout->paragraph_length == paragraph_length &&
+        memcmp(layout->key_for_control, prefs->key_for_control,
+               sizeof(layout->key_for_control)) == 0) {
+      return layout;
+    }
+  }
+  // The layout isn't cached yet, so replace the oldest cache entry with it.
+  az_para_layout_t *layout = &para_layouts[next_para_layout_index];
+  next_para_layout_index =
+    (next_para_layout_index + 1) % NUM_CACHED_PARAGRAPHS;
+  free(layout->ops);
+  layout->paragraph = paragraph;
+  layout->paragraph_length = paragraph_length;
+  memcpy(layout->key_for_control, prefs->key_for_control,
+         sizeof(layout->key_for_control));
+  parse_paragraph(prefs, layout);
+  return layout;
+}
+
+void az_draw_paragraph(
+    double height, az_alignment_t align, double x, double top, double spacing,
+    int max_chars, const az_preferences_t *prefs, const char *paragraph) {
+  assert(prefs != NULL);
+  assert(paragraph != NULL);
+  const az_para_layout_t *layout = get_paragraph_layout(prefs, paragraph);
+  // Start out with white, non-italic text.
+  glColor3f(1, 1, 1);
+  bool italic = false;
+  // Replay the drawing operations.  We will return from this function when we
+  // run out of operations, or after printing max_chars characters.
+  int chars_printed = 0; // how many chars we've printed so far
+  int chars_before_line = 0; // how many chars we'd printed when line started
+  int line_pauses = 0; // how many chars "printed" on this line were pauses
+  double line_left = x; // x-position of the left side of the current line
+  double line_top = top; // y-position of top of the current line
+  for (int i = 0; i < layout->num_ops; ++i) {
+    if (chars_printed == max_chars) return;
+    const az_para_op_t *op = &layout->ops[i];
+    switch (op->kind) {
+      case PARA_OP_LINE:
+        if (i > 0) line_top += spacing;
+        chars_before_line = chars_printed;
+        line_pauses = 0;
+        line_left = x;
+        if (align == AZ_ALIGN_RIGHT) line_left -= op->value * height;
+        else if (align == AZ_ALIGN_CENTER) {
+          line_left -= 0.5 * (op->value * height - 0.25 * height);
+        }
+        break;
+      case PARA_OP_TEXT: {
+        int len = op->value;
+        if (max_chars >= 0 && max_chars - chars_printed < len) {
+          len = max_chars - chars_printed;
+        }
+        draw_chars_internal(
+            height, AZ_ALIGN_LEFT, line_left +
+            height * (chars_printed - line_pauses - chars_before_line),
+            line_top, italic, op->chars, len);
+        chars_printed += len;
+      } break;
+      case PARA_OP_KEY: {
+        // If our max_chars falls in the middle of the key name, we'll have to
+        // cut the key name short.
+        int len = op->value;
         if (chars_printed < max_chars && max_chars - chars_printed < len) {
           len = max_chars - chars_printed;
         }
         draw_chars_internal(
             height, AZ_ALIGN_LEFT,
             line_left + height * (chars_printed - chars_before_line),
-            line_top, italic, key_name, len);
+            line_top, italic, op->chars, len);
         chars_printed += len;
-      }
+      } break;
+      case PARA_OP_PAUSE: {
+        int pause = op->value;
+        if (pause > max_chars - chars_printed) {
+          pause = max_chars - chars_printed;
+        }
+        chars_printed += pause;
+        line_pauses += pause;
+      } break;
+      case PARA_OP_COLOR:
+        glColor3f(op->red, op->green, op->blue);
+        break;
+      case PARA_OP_ITALIC:
+        italic = (bool)op->value;
+        break;
     }
-    // Advance to the next line.
-    chars_before_line = chars_printed;
-    line_pauses = 0;
-    line_start = fragment_start;
-    line_top += spacing;
   }
 }
 
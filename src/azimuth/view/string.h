@@ -34,6 +34,11 @@ typedef enum {
   AZ_ALIGN_RIGHT
 } az_alignment_t;
 
+// Call this at program startup to initialize drawing of text.  This must be
+// called _after_ az_init_gui, and must be called _before_ any calls to the
+// other functions in this file.
+void az_init_string_drawing(void);
+
 // Draw a (null-terminated) string.  You must set the current color before
 // calling this.
 void az_draw_string(double height, az_alignment_t align, double x, double top,
@@ -86,6 +91,8 @@ void az_draw_printf(double height, az_alignment_t align, double x, double top,
 //   $7 - insert name of prefs PIERCE key
 //   $8 - insert name of prefs BEAM key
 //   $9 - insert name of prefs ROCKETS key
+// The parsed layout of the paragraph is cached by the paragraph's address, so
+// the paragraph's contents must not be changed while it is still in use.
 void az_draw_paragraph(
     double height, az_alignment_t align, double x, double top, double spacing,
     int max_chars, const az_preferences_t *prefs, const char *paragraph);
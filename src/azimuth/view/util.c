@@ -19,7 +19,9 @@
 
 #include "azimuth/view/util.h"
 
+#include <assert.h>
 #include <math.h>
+#include <stdbool.h>
 
 #include <GL/gl.h>
 
@@ -44,6 +46,64 @@ void az_gl_vertex(az_vector_t v) {
   glVertex2d(v.x, v.y);
 }
 
+static struct {
+  bool initialized;
+  double cos[360];
+  double sin[360];
+} trig_table;
+
+static int table_index(int degrees) {
+  if (!trig_table.initialized) {
+    for (int i = 0; i < 360; ++i) {
+      trig_table.cos[i] = cos(AZ_DEG2RAD(i));
+      trig_table.sin[i] = sin(AZ_DEG2RAD(i));
+    }
+    trig_table.initialized = true;
+  }
+  const int index = degrees % 360;
+  return (index < 0 ? index + 360 : index);
+}
+
+double az_cos_deg(int degrees) {
+  return trig_table.cos[table_index(degrees)];
+}
+
+double az_sin_deg(int degrees) {
+  return trig_table.sin[table_index(degrees)];
+}
+
+void az_gl_vertex_polar_deg(double radius, int degrees) {
+  const int index = table_index(degrees);
+  glVertex2d(radius * trig_table.cos[index], radius * trig_table.sin[index]);
+}
+
+void az_gl_arc_vertices(double x_radius, double y_radius, int start_degrees,
+                        int end_degrees, int step_degrees) {
+  assert(step_degrees > 0);
+  int index = table_index(start_degrees);
+  for (int degrees = start_degrees; degrees <= end_degrees;
+       degrees += step_degrees) {
+    glVertex2d(x_radius * trig_table.cos[index],
+               y_radius * trig_table.sin[index]);
+    index += step_degrees;
+    if (index >= 360) index %= 360;
+  }
+}
+
+void az_gl_circle_vertices(double radius, int step_degrees) {
+  az_gl_arc_vertices(radius, radius, 0, 360, step_degrees);
+}
+
+void az_draw_glow_ball(double radius, int step_degrees, az_color_t inner_color,
+                       az_color_t outer_color) {
+  glBegin(GL_TRIANGLE_FAN); {
+    az_gl_color(inner_color);
+    glVertex2f(0, 0);
+    az_gl_color(outer_color);
+    az_gl_circle_vertices(radius, step_degrees);
+  } glEnd();
+}
+
 void az_draw_cracks(az_vector_t origin, double angle, double length) {
   az_draw_cracks_with_color(origin, angle, length, (az_color_t){0, 0, 0, 64});
 }
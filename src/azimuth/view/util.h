@@ -39,6 +39,29 @@ void az_gl_translated(az_vector_t v);
 // Place a GL vertex at the given position.
 void az_gl_vertex(az_vector_t v);
 
+// Return the cosine/sine of an angle given in whole degrees (which may be any
+// integer, including negative).  These use a precomputed table, and so are
+// much cheaper than calling cos()/sin() on AZ_DEG2RAD(degrees).
+double az_cos_deg(int degrees);
+double az_sin_deg(int degrees);
+
+// Place a GL vertex at the given polar position, with the angle in degrees.
+void az_gl_vertex_polar_deg(double radius, int degrees);
+
+// Place GL vertices along an elliptical arc centered on the origin, from
+// start_degrees to end_degrees inclusive, every step_degrees degrees.
+void az_gl_arc_vertices(double x_radius, double y_radius, int start_degrees,
+                        int end_degrees, int step_degrees);
+
+// Place GL vertices all the way around a circle centered on the origin,
+// starting and ending at zero degrees.
+void az_gl_circle_vertices(double radius, int step_degrees);
+
+// Draw a filled circle centered on the origin, shading from inner_color at
+// the center to outer_color at the rim.
+void az_draw_glow_ball(double radius, int step_degrees, az_color_t inner_color,
+                       az_color_t outer_color);
+
 void az_draw_cracks(az_vector_t origin, double angle, double length);
 void az_draw_cracks_with_color(az_vector_t origin, double angle, double length,
                                az_color_t color);
@@ -36,6 +36,10 @@
 #include "azimuth/state/upgrade.h"
 #include "azimuth/state/wall.h" // for az_init_wall_datas
 #include "azimuth/util/misc.h"
+#include "azimuth/view/background.h" // for az_init_background_drawing
+#include "azimuth/view/baddie.h" // for az_init_baddie_drawing
+#include "azimuth/view/doodad.h" // for az_init_doodad_drawing
+#include "azimuth/view/string.h" // for az_init_string_drawing
 #include "azimuth/view/wall.h" // for az_init_wall_drawing
 #include "editor/list.h"
 #include "editor/state.h"
@@ -1783,7 +1787,11 @@ static void event_loop(void) {
 int main(int argc, char **argv) {
   az_init_baddie_datas();
   az_init_wall_datas();
+  az_register_gl_init_func(az_init_string_drawing);
+  az_register_gl_init_func(az_init_background_drawing);
+  az_register_gl_init_func(az_init_baddie_drawing);
   az_register_gl_init_func(az_init_wall_drawing);
+  az_register_gl_init_func(az_init_doodad_drawing);
   if (!az_load_editor_state(&state)) {
     printf("Failed to load scenario.\n");
     return EXIT_FAILURE;
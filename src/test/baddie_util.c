@@ -0,0 +1,72 @@
+/*=============================================================================
+| Copyright 2012 Matthew D. Steele <mdsteele@alum.mit.edu>                    |
+|                                                                             |
+| This file is part of Azimuth.                                               |
+|                                                                             |
+| Azimuth is free software: you can redistribute it and/or modify it under    |
+| the terms of the GNU General Public License as published by the Free        |
+| Software Foundation, either version 3 of the License, or (at your option)   |
+| any later version.                                                          |
+|                                                                             |
+| Azimuth is distributed in the hope that it will be useful, but WITHOUT      |
+| ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or       |
+| FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for   |
+| more details.                                                               |
+|                                                                             |
+| You should have received a copy of the GNU General Public License along     |
+| with Azimuth.  If not, see <http://www.gnu.org/licenses/>.                  |
+=============================================================================*/
+
+#include <stdbool.h>
+
+#include "azimuth/state/baddie.h"
+#include "azimuth/state/space.h"
+#include "azimuth/state/wall.h"
+#include "azimuth/tick/baddie_util.h"
+#include "azimuth/util/vector.h"
+#include "test/test.h"
+
+/*===========================================================================*/
+
+static az_space_state_t flyer_state;
+
+static az_baddie_t *add_flyer(double angle) {
+  static bool datas_initialized = false;
+  if (!datas_initialized) {
+    az_init_baddie_datas();
+    az_init_wall_datas();
+    datas_initialized = true;
+  }
+  az_clear_space(&flyer_state);
+  return az_add_baddie(&flyer_state, AZ_BAD_NIGHTBUG, AZ_VZERO, angle);
+}
+
+static void fly_for(az_baddie_t *baddie, double duration) {
+  for (double time = 0.0; time < duration; time += 0.1) {
+    az_fly_towards_ship(&flyer_state, baddie, 0.1,
+                        3.0, 40.0, 100.0, 20.0, 100.0, 100.0);
+  }
+}
+
+void test_fly_towards_ship(void) {
+  // With no walls nearby and no ship in range, there's no drift at all, so a
+  // flying baddie turns to face angle zero.
+  az_baddie_t *baddie = add_flyer(2.0);
+  ASSERT_TRUE(baddie != NULL);
+  fly_for(baddie, 3.0);
+  EXPECT_APPROX(0.0, baddie->angle);
+
+  // A lone wall well beyond the force field cutoff should still steer the
+  // baddie away from it (rather than, say, due east).
+  baddie = add_flyer(2.0);
+  ASSERT_TRUE(baddie != NULL);
+  az_wall_t *wall = &flyer_state.walls[0];
+  wall->kind = AZ_WALL_INDESTRUCTIBLE;
+  wall->data = az_get_wall_data(0);
+  wall->position = az_vwithlen((az_vector_t){1, 1},
+                               wall->data->bounding_radius + 300.0);
+  fly_for(baddie, 3.0);
+  EXPECT_APPROX(-0.75 * AZ_PI, baddie->angle);
+}
+
+/*===========================================================================*/
@@ -23,6 +23,7 @@
 
 int main(int argc, char **argv) {
   RUN_TEST(test_alloc);
+  RUN_TEST(test_arc_circle_bounding_box);
   RUN_TEST(test_arc_circle_hits_circle);
   RUN_TEST(test_arc_circle_hits_line);
   RUN_TEST(test_arc_circle_hits_line_segment);
@@ -55,12 +56,18 @@ int main(int argc, char **argv) {
   RUN_TEST(test_cubic_bezier_arc_param);
   RUN_TEST(test_cubic_bezier_point);
   RUN_TEST(test_find_knee);
+  RUN_TEST(test_fly_towards_ship);
   RUN_TEST(test_hint_matches);
   RUN_TEST(test_hsva_color);
   RUN_TEST(test_is_number_key);
   RUN_TEST(test_lead_target);
   RUN_TEST(test_modulo);
   RUN_TEST(test_mod2pi);
+  RUN_TEST(test_pacer_deadlines);
+  RUN_TEST(test_pacer_detects_vsync);
+  RUN_TEST(test_pacer_histogram);
+  RUN_TEST(test_pacer_ignores_fast_vsync);
+  RUN_TEST(test_pacer_settles_with_fast_vsync);
   RUN_TEST(test_paragraph_length);
   RUN_TEST(test_paragraph_read);
   RUN_TEST(test_parse_music);
@@ -72,6 +79,10 @@ int main(int argc, char **argv) {
   RUN_TEST(test_player_set_zone_mapped);
   RUN_TEST(test_polygon_contains);
   RUN_TEST(test_polygon_contains_circle);
+  RUN_TEST(test_polygon_convex_fast_paths);
+  RUN_TEST(test_polygon_convexity);
+  RUN_TEST(test_polygon_pieces);
+  RUN_TEST(test_polygon_pieces_fast_paths);
   RUN_TEST(test_position_visible);
   RUN_TEST(test_prefs_defaults);
   RUN_TEST(test_prefs_missing_values);
@@ -87,9 +98,12 @@ int main(int argc, char **argv) {
   RUN_TEST(test_script_clone);
   RUN_TEST(test_script_print);
   RUN_TEST(test_script_scan);
+  RUN_TEST(test_script_timers);
   RUN_TEST(test_select_gun);
   RUN_TEST(test_signmod);
+  RUN_TEST(test_snapshot_ring);
   RUN_TEST(test_sound_volume);
+  RUN_TEST(test_space_snapshot);
   RUN_TEST(test_strdup);
   RUN_TEST(test_strprintf);
   RUN_TEST(test_transition_color);
@@ -0,0 +1,186 @@
+/*=============================================================================
+| Copyright 2012 Matthew D. Steele <mdsteele@alum.mit.edu>                    |
+|                                                                             |
+| This file is part of Azimuth.                                               |
+|                                                                             |
+| Azimuth is free software: you can redistribute it and/or modify it under    |
+| the terms of the GNU General Public License as published by the Free        |
+| Software Foundation, either version 3 of the License, or (at your option)   |
+| any later version.                                                          |
+|                                                                             |
+| Azimuth is distributed in the hope that it will be useful, but WITHOUT      |
+| ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or       |
+| FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for   |
+| more details.                                                               |
+|                                                                             |
+| You should have received a copy of the GNU General Public License along     |
+| with Azimuth.  If not, see <http://www.gnu.org/licenses/>.                  |
+=============================================================================*/
+
+#include "azimuth/util/pacer.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "test/test.h"
+
+/*===========================================================================*/
+
+#define PERIOD 16000000u
+
+// Present a frame whose swap starts at the given time and blocks for the given
+// amount of time.
+static void present(az_pacer_t *pacer, uint64_t start, uint64_t block) {
+  az_pacer_frame_presented(pacer, start, start + block);
+}
+
+void test_pacer_deadlines(void) {
+  az_pacer_t pacer;
+  az_init_pacer(&pacer, PERIOD);
+  EXPECT_INT_EQ(0, az_pacer_next_deadline(&pacer));
+  // Without vsync, each frame should be due one period after the last.
+  present(&pacer, 1000000000u, 100000);
+  EXPECT_TRUE(az_pacer_next_deadline(&pacer) == 1000000000u + PERIOD);
+  present(&pacer, 1000000000u + PERIOD, 100000);
+  EXPECT_TRUE(az_pacer_next_deadline(&pacer) == 1000000000u + 2 * PERIOD);
+  // Being a little late shouldn't push back the schedule.
+  present(&pacer, 1000000000u + 2 * PERIOD + 3000000u, 100000);
+  EXPECT_TRUE(az_pacer_next_deadline(&pacer) == 1000000000u + 3 * PERIOD);
+  EXPECT_INT_EQ(0, pacer.num_missed);
+  // But if we miss a frame entirely, we should start counting from now rather
+  // than trying to catch up.
+  const uint64_t late = 1000000000u + 5 * PERIOD + 1000000u;
+  present(&pacer, late, 100000);
+  EXPECT_TRUE(az_pacer_next_deadline(&pacer) == late + PERIOD);
+  EXPECT_INT_EQ(1, pacer.num_missed);
+  EXPECT_INT_EQ(3, pacer.num_frames);
+  EXPECT_FALSE(pacer.vsync_effective);
+}
+
+void test_pacer_detects_vsync(void) {
+  az_pacer_t pacer;
+  az_init_pacer(&pacer, PERIOD);
+  // Swaps that block for most of a frame mean that vsync is working, in
+  // which case we shouldn't wait on top of it.
+  uint64_t time = 1000000000u;
+  for (int i = 0; i < 20; ++i) {
+    present(&pacer, time, PERIOD - 2000000u);
+    time += PERIOD;
+  }
+  EXPECT_TRUE(pacer.vsync_effective);
+  EXPECT_INT_EQ(0, az_pacer_next_deadline(&pacer));
+  // A single swap that doesn't block shouldn't change our minds...
+  present(&pacer, time, 10000);
+  time += PERIOD;
+  EXPECT_TRUE(pacer.vsync_effective);
+  // ...but a run of them should.
+  for (int i = 0; i < 20; ++i) {
+    present(&pacer, time, 10000);
+    time += PERIOD;
+  }
+  EXPECT_FALSE(pacer.vsync_effective);
+  EXPECT_TRUE(az_pacer_next_deadline(&pacer) != 0);
+}
+
+void test_pacer_ignores_fast_vsync(void) {
+  az_pacer_t pacer;
+  az_init_pacer(&pacer, PERIOD);
+  // If vsync is working but the display refreshes much faster than we want to
+  // draw, we still need to wait for our own deadlines.
+  uint64_t time = 1000000000u;
+  for (int i = 0; i < 20; ++i) {
+    present(&pacer, time, 5000000u);
+    time += 7000000u;
+  }
+  EXPECT_TRUE(pacer.vsync_effective);
+  EXPECT_TRUE(az_pacer_next_deadline(&pacer) != 0);
+}
+
+// Simulate running the pacer against a vsynced display that refreshes every
+// refresh nanoseconds, taking render nanoseconds to draw each frame, and
+// (if wait is true) really waiting for the pacer's deadlines.  Returns the
+// time at which the last swap finished.
+static uint64_t run_display(az_pacer_t *pacer, uint64_t time, bool wait,
+                            uint64_t refresh, uint64_t render, int num_frames,
+                            uint64_t *min_interval, uint64_t *max_interval) {
+  uint64_t last_swap_end = 0;
+  *min_interval = UINT64_MAX;
+  *max_interval = 0;
+  for (int i = 0; i < num_frames; ++i) {
+    time += render;
+    const uint64_t deadline = az_pacer_next_deadline(pacer);
+    if (wait && deadline > time) time = deadline;
+    const uint64_t swap_start = time;
+    time = (time / refresh + 1) * refresh;
+    az_pacer_frame_presented(pacer, swap_start, time);
+    if (last_swap_end != 0) {
+      const uint64_t interval = time - last_swap_end;
+      if (interval < *min_interval) *min_interval = interval;
+      if (interval > *max_interval) *max_interval = interval;
+    }
+    last_swap_end = time;
+  }
+  return time;
+}
+
+void test_pacer_settles_with_fast_vsync(void) {
+  az_pacer_t pacer;
+  az_init_pacer(&pacer, PERIOD);
+  const uint64_t refresh = 6944444u; // 144 Hz
+  uint64_t min_interval, max_interval;
+  // Swapping as fast as we can on a 144 Hz display should teach us its
+  // refresh period.
+  uint64_t time = run_display(&pacer, 1000000000u, false, refresh, 1000000u,
+                              20, &min_interval, &max_interval);
+  EXPECT_TRUE(pacer.vsync_effective);
+  EXPECT_TRUE(pacer.display_period > refresh - 100000u);
+  EXPECT_TRUE(pacer.display_period < refresh + 100000u);
+  // Once we start waiting for our own deadlines, we should settle into
+  // presenting every two or three refreshes, rather than mistaking our own
+  // pacing for the display's and oscillating between waiting and not.
+  const uint64_t start = run_display(&pacer, time, true, refresh, 1000000u,
+                                     1, &min_interval, &max_interval);
+  time = run_display(&pacer, start, true, refresh, 1000000u, 200,
+                     &min_interval, &max_interval);
+  EXPECT_TRUE(pacer.display_period > refresh - 100000u);
+  EXPECT_TRUE(pacer.display_period < refresh + 100000u);
+  EXPECT_TRUE(az_pacer_next_deadline(&pacer) != 0);
+  EXPECT_TRUE(min_interval >= 2 * refresh);
+  EXPECT_TRUE(max_interval <= 3 * refresh);
+  // Over the long run, we should average out to the period we asked for.
+  EXPECT_TRUE(time - start > 200 * PERIOD - 3 * refresh);
+  EXPECT_TRUE(time - start < 200 * PERIOD + 3 * refresh);
+
+  // Changing the period should make us confirm vsync again, but shouldn't
+  // make us forget how fast the display refreshes.
+  az_set_pacer_period(&pacer, PERIOD / 4);
+  EXPECT_TRUE(pacer.display_period > refresh - 100000u);
+  EXPECT_TRUE(pacer.display_period < refresh + 100000u);
+  EXPECT_FALSE(pacer.vsync_effective);
+  // When we want frames faster than the display can show them, we should
+  // (once we notice vsync again) let it pace us, and present every refresh.
+  time = run_display(&pacer, time, true, refresh, 1000000u, 50,
+                     &min_interval, &max_interval);
+  run_display(&pacer, time, true, refresh, 1000000u, 50,
+              &min_interval, &max_interval);
+  EXPECT_TRUE(pacer.vsync_effective);
+  EXPECT_INT_EQ(0, az_pacer_next_deadline(&pacer));
+  EXPECT_TRUE(min_interval >= refresh - 1u);
+  EXPECT_TRUE(max_interval <= refresh + 1u);
+}
+
+void test_pacer_histogram(void) {
+  az_pacer_t pacer;
+  az_init_pacer(&pacer, PERIOD);
+  present(&pacer, 1000000000u, 0);
+  present(&pacer, 1000000000u + 16500000u, 0);
+  present(&pacer, 1000000000u + 33000000u, 0);
+  present(&pacer, 1000000000u + 34000000u, 0);
+  present(&pacer, 1000000000u + 900000000u, 0);
+  EXPECT_INT_EQ(4, pacer.num_frames);
+  EXPECT_INT_EQ(2, pacer.histogram[16]);
+  EXPECT_INT_EQ(1, pacer.histogram[1]);
+  EXPECT_INT_EQ(1, pacer.histogram[AZ_PACER_NUM_BUCKETS - 1]);
+}
+
+/*===========================================================================*/
@@ -41,6 +41,13 @@ static const az_vector_t concave_hexagon_vertices[6] = {
 static const az_polygon_t concave_hexagon =
   AZ_INIT_POLYGON(concave_hexagon_vertices);
 
+// A clockwise comb shape, with three teeth pointing in the -Y direction.
+static const az_vector_t comb_vertices[10] = {
+  {-4, 3}, {4, 3}, {4, -4}, {2.5, -4}, {2, 0}, {0.5, -4}, {-0.5, -4},
+  {-1, 0}, {-2.5, -4}, {-4, -4}
+};
+static const az_polygon_t comb = AZ_INIT_POLYGON(comb_vertices);
+
 static const az_vector_t nix = {99999, 99999};
 
 /*===========================================================================*/
@@ -93,6 +100,198 @@ void test_polygon_contains_circle(void) {
   EXPECT_FALSE(az_polygon_contains_circle(null_polygon, 0.01, AZ_VZERO));
 }
 
+void test_polygon_convexity(void) {
+  // Both convex fixtures wind counterclockwise (the square's collinear vertex
+  // shouldn't matter).
+  az_polygon_t polygon = triangle;
+  az_init_polygon_convexity(&polygon);
+  EXPECT_INT_EQ(1, polygon.convex_winding);
+  polygon = square;
+  az_init_polygon_convexity(&polygon);
+  EXPECT_INT_EQ(1, polygon.convex_winding);
+
+  // Reversing a convex polygon should reverse its winding.
+  const az_vector_t reversed_vertices[3] = {{1, 4}, {2, 0}, {-3, -3}};
+  polygon = (az_polygon_t)AZ_INIT_POLYGON(reversed_vertices);
+  az_init_polygon_convexity(&polygon);
+  EXPECT_INT_EQ(-1, polygon.convex_winding);
+
+  // A concave polygon is not convex.
+  polygon = concave_hexagon;
+  az_init_polygon_convexity(&polygon);
+  EXPECT_INT_EQ(0, polygon.convex_winding);
+
+  // A pentagram turns the same way at every vertex, but winds around twice,
+  // so it is not convex either.
+  const az_vector_t pentagram_vertices[5] = {
+    {0, 5}, {-3, -4}, {5, 2}, {-5, 2}, {3, -4}
+  };
+  polygon = (az_polygon_t)AZ_INIT_POLYGON(pentagram_vertices);
+  az_init_polygon_convexity(&polygon);
+  EXPECT_INT_EQ(0, polygon.convex_winding);
+
+  // The null polygon is not convex.
+  polygon = null_polygon;
+  az_init_polygon_convexity(&polygon);
+  EXPECT_INT_EQ(0, polygon.convex_winding);
+}
+
+// Check that a polygon's fast paths agree with the general-purpose code on a
+// grid of sample points and, from each point, a sweep of ray and circle casts.
+static void check_fast_paths_agree(az_polygon_t generic, az_polygon_t fast) {
+  for (int x = -10; x <= 10; ++x) {
+    for (int y = -10; y <= 10; ++y) {
+      // The sample points are offset so that none lies exactly on an edge
+      // (where containment is a tie).  Normals aren't normalized, so we
+      // compare only their directions.
+      const az_vector_t start = {0.5 * x + 0.13, 0.5 * y - 0.21};
+      EXPECT_TRUE(az_polygon_contains(generic, start) ==
+                  az_polygon_contains(fast, start));
+      EXPECT_TRUE(az_circle_touches_polygon(generic, 0.5, start) ==
+                  az_circle_touches_polygon(fast, 0.5, start));
+      for (int degrees = 0; degrees < 360; degrees += 30) {
+        const az_vector_t delta = az_vpolar(8.0, AZ_DEG2RAD(degrees + 7));
+        az_vector_t pos1 = nix, pos2 = nix, norm1 = nix, norm2 = nix;
+        EXPECT_TRUE(az_ray_hits_polygon(generic, start, delta,
+                                        &pos1, &norm1) ==
+                    az_ray_hits_polygon(fast, start, delta,
+                                        &pos2, &norm2));
+        EXPECT_VAPPROX(pos1, pos2);
+        EXPECT_VAPPROX(az_vunit(norm1), az_vunit(norm2));
+        pos1 = pos2 = norm1 = norm2 = nix;
+        EXPECT_TRUE(az_circle_hits_polygon(generic, 0.5, start, delta,
+                                           &pos1, &norm1) ==
+                    az_circle_hits_polygon(fast, 0.5, start, delta,
+                                           &pos2, &norm2));
+        EXPECT_VAPPROX(pos1, pos2);
+        EXPECT_VAPPROX(az_vunit(norm1), az_vunit(norm2));
+      }
+    }
+  }
+}
+
+// The convex fast paths should always agree with the general-purpose code.
+void test_polygon_convex_fast_paths(void) {
+  const az_polygon_t generic_polygons[] = {triangle, square};
+  AZ_ARRAY_LOOP(generic, generic_polygons) {
+    az_polygon_t convex = *generic;
+    az_init_polygon_convexity(&convex);
+    EXPECT_TRUE(convex.convex_winding != 0);
+    check_fast_paths_agree(*generic, convex);
+  }
+}
+
+// Return the signed area of the polygon (positive if counterclockwise).
+static double signed_area(int num_vertices, const az_vector_t *vertices) {
+  double area = 0.0;
+  for (int i = num_vertices - 1, j = 0; i >= 0; j = i--) {
+    area += 0.5 * az_vcross(vertices[i], vertices[j]);
+  }
+  return area;
+}
+
+// Check that the polygon's pieces are convex, counterclockwise, and together
+// cover exactly the polygon's area, and that each edge of the polygon is an
+// edge of the piece it is said to border.
+static void check_pieces(az_polygon_t polygon) {
+  double total_area = 0.0;
+  for (int p = 0; p < polygon.num_pieces; ++p) {
+    const az_polygon_piece_t *piece = &polygon.pieces[p];
+    EXPECT_TRUE(piece->num_vertices >= 3);
+    for (int i = 0; i < piece->num_vertices; ++i) {
+      const az_vector_t vertex = piece->vertices[i];
+      EXPECT_TRUE(az_vwithin(vertex, piece->center, piece->radius));
+      for (int k = 0; k < piece->num_vertices; ++k) {
+        EXPECT_TRUE(az_vdot(piece->normals[i], az_vsub(
+            piece->vertices[k], vertex)) <= 1e-9);
+      }
+    }
+    const double area = signed_area(piece->num_vertices, piece->vertices);
+    EXPECT_TRUE(area > 0.0);
+    total_area += area;
+  }
+  EXPECT_APPROX(fabs(signed_area(polygon.num_vertices, polygon.vertices)),
+                total_area);
+  for (int i = polygon.num_vertices - 1, j = 0; i >= 0; j = i--) {
+    const int p = polygon.edge_pieces[i];
+    ASSERT_TRUE(0 <= p && p < polygon.num_pieces);
+    const az_polygon_piece_t *piece = &polygon.pieces[p];
+    bool found = false;
+    for (int k = 0; k < piece->num_vertices; ++k) {
+      const az_vector_t v1 = piece->vertices[k];
+      const az_vector_t v2 = piece->vertices[(k + 1) % piece->num_vertices];
+      if ((az_vapprox(v1, polygon.vertices[i]) &&
+           az_vapprox(v2, polygon.vertices[j])) ||
+          (az_vapprox(v1, polygon.vertices[j]) &&
+           az_vapprox(v2, polygon.vertices[i]))) found = true;
+    }
+    EXPECT_TRUE(found);
+  }
+}
+
+void test_polygon_pieces(void) {
+  // A convex polygon is its own only piece (the square's collinear vertex
+  // shouldn't matter).
+  az_polygon_t polygon = square;
+  az_init_polygon_pieces(&polygon);
+  EXPECT_INT_EQ(1, polygon.convex_winding);
+  EXPECT_INT_EQ(1, polygon.num_pieces);
+  EXPECT_INT_EQ(5, polygon.pieces[0].num_vertices);
+  for (int i = 0; i < 5; ++i) EXPECT_INT_EQ(0, polygon.edge_pieces[i]);
+  check_pieces(polygon);
+  az_destroy_polygon_pieces(&polygon);
+  EXPECT_INT_EQ(0, polygon.num_pieces);
+
+  // Clockwise polygons get counterclockwise pieces.
+  const az_vector_t reversed_vertices[3] = {{1, 4}, {2, 0}, {-3, -3}};
+  polygon = (az_polygon_t)AZ_INIT_POLYGON(reversed_vertices);
+  az_init_polygon_pieces(&polygon);
+  EXPECT_INT_EQ(1, polygon.num_pieces);
+  check_pieces(polygon);
+  az_destroy_polygon_pieces(&polygon);
+
+  // Concave polygons get split up.
+  polygon = concave_hexagon;
+  az_init_polygon_pieces(&polygon);
+  EXPECT_INT_EQ(0, polygon.convex_winding);
+  EXPECT_TRUE(polygon.num_pieces >= 2);
+  check_pieces(polygon);
+  az_destroy_polygon_pieces(&polygon);
+  polygon = comb;
+  az_init_polygon_pieces(&polygon);
+  EXPECT_TRUE(polygon.num_pieces >= 4);
+  check_pieces(polygon);
+  az_destroy_polygon_pieces(&polygon);
+
+  // A pentagram turns the same way at every vertex, but winds around twice,
+  // so it doesn't get pieces.
+  const az_vector_t pentagram_vertices[5] = {
+    {0, 5}, {-3, -4}, {5, 2}, {-5, 2}, {3, -4}
+  };
+  polygon = (az_polygon_t)AZ_INIT_POLYGON(pentagram_vertices);
+  az_init_polygon_pieces(&polygon);
+  EXPECT_INT_EQ(0, polygon.num_pieces);
+
+  // Neither does the null polygon.
+  polygon = null_polygon;
+  az_init_polygon_pieces(&polygon);
+  EXPECT_INT_EQ(0, polygon.num_pieces);
+}
+
+// The fast paths for polygons with pieces should always agree with the
+// general-purpose code.
+void test_polygon_pieces_fast_paths(void) {
+  const az_polygon_t generic_polygons[] =
+    {triangle, square, concave_hexagon, comb};
+  AZ_ARRAY_LOOP(generic, generic_polygons) {
+    az_polygon_t fast = *generic;
+    az_init_polygon_pieces(&fast);
+    EXPECT_TRUE(fast.num_pieces > 0);
+    check_fast_paths_agree(*generic, fast);
+    az_destroy_polygon_pieces(&fast);
+  }
+}
+
 /*===========================================================================*/
 
 void test_circle_touches_line(void) {
@@ -161,6 +360,15 @@ void test_ray_hits_bounding_circle(void) {
   // Ray pointed towards circle, but stops just short:
   EXPECT_FALSE(az_ray_hits_bounding_circle(
       (az_vector_t){-1, 2}, (az_vector_t){0, -1}, (az_vector_t){-1, -1}, 1));
+  // Ray's bounding box is far from circle:
+  EXPECT_FALSE(az_ray_hits_bounding_circle(
+      (az_vector_t){10, 10}, (az_vector_t){1, 1}, (az_vector_t){0, 0}, 2));
+  // Ray's bounding box overlaps circle, but ray itself misses:
+  EXPECT_FALSE(az_ray_hits_bounding_circle(
+      (az_vector_t){0, 3}, (az_vector_t){3, -3}, (az_vector_t){0, 0}, 2));
+  // Ray ends just inside circle:
+  EXPECT_TRUE(az_ray_hits_bounding_circle(
+      (az_vector_t){-5, 0}, (az_vector_t){3.5, 0}, (az_vector_t){0, 0}, 2));
 }
 
 void test_ray_hits_circle(void) {
@@ -697,6 +905,46 @@ void test_circle_hits_polygon_trans(void) {
 
 /*===========================================================================*/
 
+void test_arc_circle_bounding_box(void) {
+  az_vector_t min, max;
+  // A quarter turn from the +X axis to the +Y axis:
+  az_arc_circle_bounding_box(1, (az_vector_t){13, 20}, (az_vector_t){10, 20},
+                             AZ_HALF_PI, &min, &max);
+  EXPECT_VAPPROX(((az_vector_t){9, 19}), min);
+  EXPECT_VAPPROX(((az_vector_t){14, 24}), max);
+  // The same arc, travelled in the other direction:
+  az_arc_circle_bounding_box(1, (az_vector_t){10, 23}, (az_vector_t){10, 20},
+                             -AZ_HALF_PI, &min, &max);
+  EXPECT_VAPPROX(((az_vector_t){9, 19}), min);
+  EXPECT_VAPPROX(((az_vector_t){14, 24}), max);
+  // A full turn (or more) covers the whole circle:
+  az_arc_circle_bounding_box(0.5, (az_vector_t){0, 2}, AZ_VZERO, -7.0,
+                             &min, &max);
+  EXPECT_VAPPROX(((az_vector_t){-2.5, -2.5}), min);
+  EXPECT_VAPPROX(((az_vector_t){2.5, 2.5}), max);
+
+  // For arbitrary arcs, the box should contain the circle at every point
+  // along the way.
+  const az_vector_t spin_center = {1.5, -2.0};
+  for (int start_degrees = 5; start_degrees < 360; start_degrees += 40) {
+    const az_vector_t start =
+      az_vadd(spin_center, az_vpolar(3.0, AZ_DEG2RAD(start_degrees)));
+    for (int spin_degrees = -400; spin_degrees <= 400; spin_degrees += 35) {
+      az_arc_circle_bounding_box(0.5, start, spin_center,
+                                 AZ_DEG2RAD(spin_degrees), &min, &max);
+      for (int step = 0; step <= 20; ++step) {
+        const az_vector_t pos = az_vadd(spin_center, az_vrotate(
+            az_vsub(start, spin_center),
+            AZ_DEG2RAD(spin_degrees) * step / 20.0));
+        EXPECT_TRUE(pos.x - 0.5 >= min.x - 1e-9 &&
+                    pos.y - 0.5 >= min.y - 1e-9 &&
+                    pos.x + 0.5 <= max.x + 1e-9 &&
+                    pos.y + 0.5 <= max.y + 1e-9);
+      }
+    }
+  }
+}
+
 void test_arc_ray_hits_circle(void) {
   double angle = 99999;
   az_vector_t intersect = nix, normal = nix;
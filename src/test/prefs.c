@@ -66,6 +66,8 @@ void test_prefs_save_load(void) {
   const az_preferences_t expected_prefs = {
     .music_volume = 0.125f, .sound_volume = 0.75f,
     .fullscreen_on_startup = false, .speedrun_timer = true,
+    .enable_hints = false, .low_latency_input = true,
+    .pipelined_drawing = true,
     .key_for_control = {
       [AZ_CONTROL_UP]      = AZ_KEY_M,
       [AZ_CONTROL_DOWN]    = AZ_KEY_A,
@@ -102,6 +104,11 @@ void test_prefs_save_load(void) {
   EXPECT_TRUE(actual_prefs.fullscreen_on_startup ==
               expected_prefs.fullscreen_on_startup);
   EXPECT_TRUE(actual_prefs.speedrun_timer == expected_prefs.speedrun_timer);
+  EXPECT_TRUE(actual_prefs.enable_hints == expected_prefs.enable_hints);
+  EXPECT_TRUE(actual_prefs.low_latency_input ==
+              expected_prefs.low_latency_input);
+  EXPECT_TRUE(actual_prefs.pipelined_drawing ==
+              expected_prefs.pipelined_drawing);
   expect_valid_controls(actual_prefs.key_for_control);
   expect_unique_keys_for_controls(actual_prefs.key_for_control);
   expect_controls_to_match(&actual_prefs, &expected_prefs);
@@ -126,6 +133,10 @@ void test_prefs_missing_values(void) {
   EXPECT_TRUE(actual_prefs.speedrun_timer);
   EXPECT_TRUE(actual_prefs.fullscreen_on_startup ==
               default_prefs.fullscreen_on_startup);
+  EXPECT_TRUE(actual_prefs.low_latency_input ==
+              default_prefs.low_latency_input);
+  EXPECT_TRUE(actual_prefs.pipelined_drawing ==
+              default_prefs.pipelined_drawing);
   expect_valid_controls(actual_prefs.key_for_control);
   expect_unique_keys_for_controls(actual_prefs.key_for_control);
   expect_controls_to_match(&actual_prefs, &default_prefs);
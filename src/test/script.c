@@ -20,6 +20,7 @@
 #include <string.h>
 
 #include "azimuth/state/script.h"
+#include "azimuth/state/space.h"
 #include "azimuth/util/misc.h"
 #include "test/test.h"
 
@@ -94,3 +95,68 @@ void test_script_clone(void) {
 }
 
 /*===========================================================================*/
+
+static az_space_state_t timer_state;
+
+// Add a timer whose VM's pc is set to id, so we can tell them apart later.
+static void insert_timer(double delay, int id) {
+  az_timer_t *timer;
+  ASSERT_TRUE(az_insert_timer(&timer_state, delay, &timer));
+  timer->vm.pc = id;
+}
+
+static int pop_due_timer(void) {
+  az_script_vm_t vm;
+  if (!az_pop_due_timer(&timer_state, &vm)) return -1;
+  return vm.pc;
+}
+
+void test_script_timers(void) {
+  az_clear_space(&timer_state);
+  EXPECT_INT_EQ(-1, pop_due_timer());
+  // Timers should go off in order of due time, and timers due at the same
+  // time should go off in the order they were added.
+  insert_timer(3.0, 1);
+  insert_timer(1.0, 2);
+  insert_timer(2.0, 3);
+  insert_timer(1.0, 4);
+  insert_timer(0.0, 5);
+  EXPECT_INT_EQ(5, pop_due_timer());
+  EXPECT_INT_EQ(-1, pop_due_timer());
+  timer_state.timer_time = 1.5;
+  insert_timer(0.5, 6);
+  EXPECT_INT_EQ(2, pop_due_timer());
+  EXPECT_INT_EQ(4, pop_due_timer());
+  EXPECT_INT_EQ(-1, pop_due_timer());
+  timer_state.timer_time = 10.0;
+  EXPECT_INT_EQ(3, pop_due_timer());
+  EXPECT_INT_EQ(6, pop_due_timer());
+  EXPECT_INT_EQ(1, pop_due_timer());
+  EXPECT_INT_EQ(-1, pop_due_timer());
+  EXPECT_INT_EQ(0, timer_state.num_timers);
+
+  // We should be able to fill up the queue (but no further), and get
+  // everything back out again in order.
+  for (int i = 0; i < AZ_MAX_NUM_TIMERS; ++i) {
+    insert_timer((i * 37) % AZ_MAX_NUM_TIMERS, i);
+  }
+  az_timer_t *timer;
+  EXPECT_FALSE(az_insert_timer(&timer_state, 0.0, &timer));
+  timer_state.timer_time += AZ_MAX_NUM_TIMERS;
+  double prev_delay = -1.0;
+  for (int i = 0; i < AZ_MAX_NUM_TIMERS; ++i) {
+    const int id = pop_due_timer();
+    ASSERT_TRUE(id >= 0);
+    const double delay = (id * 37) % AZ_MAX_NUM_TIMERS;
+    EXPECT_TRUE(delay > prev_delay);
+    prev_delay = delay;
+  }
+  EXPECT_INT_EQ(-1, pop_due_timer());
+
+  // Clearing the space should drop any pending timers.
+  insert_timer(0.0, 7);
+  az_clear_space(&timer_state);
+  EXPECT_INT_EQ(-1, pop_due_timer());
+}
+
+/*===========================================================================*/
@@ -0,0 +1,95 @@
+/*=============================================================================
+| Copyright 2012 Matthew D. Steele <mdsteele@alum.mit.edu>                    |
+|                                                                             |
+| This file is part of Azimuth.                                               |
+|                                                                             |
+| Azimuth is free software: you can redistribute it and/or modify it under    |
+| the terms of the GNU General Public License as published by the Free        |
+| Software Foundation, either version 3 of the License, or (at your option)   |
+| any later version.                                                          |
+|                                                                             |
+| Azimuth is distributed in the hope that it will be useful, but WITHOUT      |
+| ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or       |
+| FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for   |
+| more details.                                                               |
+|                                                                             |
+| You should have received a copy of the GNU General Public License along     |
+| with Azimuth.  If not, see <http://www.gnu.org/licenses/>.                  |
+=============================================================================*/
+
+
+#include "azimuth/state/snapshot.h"
+
+#include <stdlib.h>
+
+#include "azimuth/state/space.h"
+#include "azimuth/util/misc.h"
+#include "azimuth/util/random.h"
+#include "test/test.h"
+
+/*===========================================================================*/
+
+void test_space_snapshot(void) {
+  az_space_state_t *state = AZ_ALLOC(1, az_space_state_t);
+  az_space_snapshot_t *snapshot = AZ_ALLOC(1, az_space_snapshot_t);
+  state->ship.position = (az_vector_t){10, 20};
+  state->baddies[3].kind = AZ_BAD_BOX;
+  az_take_space_snapshot(state, snapshot);
+  const double roll = az_random(0, 1);
+
+  state->ship.position = (az_vector_t){-5, 7};
+  state->baddies[3].kind = AZ_BAD_NOTHING;
+  az_random(0, 1);
+  az_restore_space_snapshot(snapshot, state);
+  EXPECT_VAPPROX(((az_vector_t){10, 20}), state->ship.position);
+  EXPECT_INT_EQ(AZ_BAD_BOX, state->baddies[3].kind);
+  EXPECT_APPROX(roll, az_random(0, 1));
+
+  free(snapshot);
+  free(state);
+}
+
+void test_snapshot_ring(void) {
+  az_space_state_t *state = AZ_ALLOC(1, az_space_state_t);
+  az_snapshot_ring_t ring;
+  az_init_snapshot_ring(&ring);
+  EXPECT_FALSE(az_rewind_snapshot_ring(&ring, 0, state));
+
+  // Push more snapshots than the ring can hold.
+  const int num_pushes = AZ_SNAPSHOT_RING_SIZE + 3;
+  for (int i = 0; i < num_pushes; ++i) {
+    state->ship.position.x = i;
+    state->projectiles[i].power = 1.0;
+    az_push_snapshot(&ring, state);
+  }
+  EXPECT_INT_EQ(AZ_SNAPSHOT_RING_SIZE, ring.num_snapshots);
+  EXPECT_FALSE(az_rewind_snapshot_ring(&ring, AZ_SNAPSHOT_RING_SIZE, state));
+
+  // Rewind to the newest snapshot; nothing should be discarded.
+  state->ship.position.x = -1;
+  ASSERT_TRUE(az_rewind_snapshot_ring(&ring, 0, state));
+  EXPECT_APPROX(num_pushes - 1, state->ship.position.x);
+  EXPECT_INT_EQ(AZ_SNAPSHOT_RING_SIZE, ring.num_snapshots);
+
+  // Rewind three more snapshots.
+  ASSERT_TRUE(az_rewind_snapshot_ring(&ring, 3, state));
+  EXPECT_APPROX(num_pushes - 4, state->ship.position.x);
+  EXPECT_APPROX(1.0, state->projectiles[num_pushes - 4].power);
+  EXPECT_APPROX(0.0, state->projectiles[num_pushes - 3].power);
+  EXPECT_INT_EQ(AZ_SNAPSHOT_RING_SIZE - 3, ring.num_snapshots);
+
+  // Push a new snapshot, then rewind all the way to the oldest one left.
+  state->ship.position.x = 100;
+  az_push_snapshot(&ring, state);
+  EXPECT_INT_EQ(AZ_SNAPSHOT_RING_SIZE - 2, ring.num_snapshots);
+  ASSERT_TRUE(az_rewind_snapshot_ring(&ring, ring.num_snapshots - 1, state));
+  EXPECT_APPROX(num_pushes - AZ_SNAPSHOT_RING_SIZE, state->ship.position.x);
+  EXPECT_APPROX(0.0, state->projectiles[num_pushes -
+                                         AZ_SNAPSHOT_RING_SIZE + 1].power);
+  EXPECT_INT_EQ(1, ring.num_snapshots);
+
+  az_destroy_snapshot_ring(&ring);
+  free(state);
+}
+
+/*===========================================================================*/
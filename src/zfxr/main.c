@@ -25,6 +25,7 @@
 #include "azimuth/gui/audio.h"
 #include "azimuth/gui/event.h"
 #include "azimuth/gui/screen.h"
+#include "azimuth/view/string.h" // for az_init_string_drawing
 #include "zfxr/state.h"
 #include "zfxr/view.h"
 
@@ -57,6 +58,7 @@ static void event_loop(void) {
 
 int main(int argc, char **argv) {
   az_init_zfxr_state(&state);
+  az_register_gl_init_func(az_init_string_drawing);
   az_init_gui(false, true);
 
   event_loop();